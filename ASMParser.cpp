@@ -1,147 +1,244 @@
 #include "ASMParser.h"
+#include "PerfCounters.h"
+#include <ctype.h>
 
-ASMParser::ASMParser(string filename)
-  // Specify a text file containing MIPS assembly instructions. Function
-  // checks syntactic correctness of file and creates a list of Instructions.
+ASMParser::ASMParser(string filename, uint64_t start)
+  // Specify a text file containing MIPS assembly instructions ("-" for
+  // standard input), to be read from byte start on.
+  : myInput(filename, start)
 {
-  Instruction i;
-  myFormatCorrect = true;
+  myFormatCorrect = myInput.isOpen();
+  myReturned = 0;
 
   myLabelAddress = 0x400000;
+}
 
-  ifstream in;
-  in.open(filename.c_str());
-  if(in.bad()){
-    myFormatCorrect = false;
-  }
-  else{
-    string line;
-    while( getline(in, line)){
-      string opcode("");
-      string operand[80];
-      int operand_count = 0;
-
-      if(line.length() == 0){
-	continue;
-      }
 
-      getTokens(line, opcode, operand, operand_count);
+Instruction ASMParser::getNextInstruction()
+  // Iterator that returns the next Instruction in the file.  Returns an
+  // UNDEFINED Instruction at the end of the file or at the first line with
+  // a syntax error (isFormatCorrect then returns false).
+{
+  Instruction i;
+  const char *line;
+  size_t length, readable;
+
+  myDefinedLabels.clear();
+  myDefinedNames.clear();
+  while(myFormatCorrect && myInput.getLine(line, length, readable)){
+    Token opcode = { line, 0 };
+    Token operand[MaxOperands];
+    int operand_count = 0;
+
+    if(length == 0){
+      continue;
+    }
 
-      if(opcode.length() == 0 && operand_count != 0){
-	// No opcode but operands
-	myFormatCorrect = false;
-	break;
-      }
+    getTokens(line, length, readable, opcode, operand, operand_count);
 
-      Opcode o = opcodes.getOpcode(opcode);      
-      if(o == UNDEFINED){
-	// invalid opcode specified
+    // leading "name:" tokens define labels at the next instruction
+    while(opcode.length > 0 && opcode.text[opcode.length - 1] == ':'){
+      if(!defineLabel(string(opcode.text, opcode.length - 1))){
 	myFormatCorrect = false;
 	break;
       }
-
-      bool success = getOperands(i, o, operand, operand_count);
-      if(!success){
-	myFormatCorrect = false;
-	break;
+      opcode.length = 0;
+      if(operand_count > 0){
+	opcode = operand[0];
+	for(int k = 1; k < operand_count; k++)
+	  operand[k - 1] = operand[k];
+	operand_count--;
       }
+    }
+    if(!myFormatCorrect)
+      break;
+    if(opcode.length == 0 && operand_count == 0 && !myDefinedLabels.empty()){
+      // a line holding only labels
+      continue;
+    }
 
-      string encoding = encode(i);
-      i.setEncoding(encoding);
+    if(opcode.length == 0 && operand_count != 0){
+      // No opcode but operands
+      myFormatCorrect = false;
+      break;
+    }
 
-      i.setAssembly(line);
-      myInstructions.push_back(i);
+    Opcode o = opcodes.getOpcode(opcode.text, opcode.length);
+    if(o == UNDEFINED){
+      // invalid opcode specified
+      myFormatCorrect = false;
+      break;
+    }
 
+    bool success = getOperands(i, o, operand, operand_count);
+    if(!success){
+      myFormatCorrect = false;
+      break;
     }
+
+    string encoding = encode(i);
+    i.setEncoding(encoding);
+
+    i.setAssembly(string(line, length));
+    myReturned++;
+    return i;
   }
 
-  myIndex = 0;
-}
+  if(myInput.hasError())
+    myFormatCorrect = false;
 
+  return Instruction();
+}
 
-Instruction ASMParser::getNextInstruction()
-  // Iterator that returns the next Instruction in the list of Instructions.
+bool ASMParser::skipLabels(const char *line, size_t n, Token &opcode)
+  // Defines the labels in front of line[0, n) and sets opcode to the word
+  // after them.  Returns true if there is one, false for a line of just
+  // labels, blanks or a comment, or at a label defined twice (which is a
+  // syntax error).
 {
-  if(myIndex < (int)(myInstructions.size())){
-    myIndex++;
-    return myInstructions[myIndex-1];
+  size_t p = 0;
+  for(;;){
+    while(p < n && isspace((unsigned char)line[p]))
+      p++;
+    if(p == n || line[p] == '#')
+      return false;
+    size_t e = p;
+    while(e < n && !isspace((unsigned char)line[e]) && line[e] != '#')
+      e++;
+    if(line[e - 1] != ':'){
+      opcode.text = line + p;
+      opcode.length = e - p;
+      return true;
+    }
+    if(!defineLabel(string(line + p, e - p - 1))){
+      myFormatCorrect = false;
+      return false;
+    }
+    p = e;
   }
-  
-  Instruction i;
-  return i;
+}
 
+long ASMParser::skip(long n)
+  // Skips the next n instructions without decoding them.  Only their
+  // opcodes and labels are checked: a line whose first word (after any
+  // labels) is not an opcode, or a label defined twice, stops the skip as a
+  // syntax error.  Returns the number skipped, less than n only at the end
+  // of the file or at such a line.
+{
+  const char *line;
+  size_t length, readable;
+  Token opcode;
+  long k = 0;
+
+  while(k < n && myFormatCorrect && myInput.getLine(line, length, readable)){
+    if(skipLabels(line, length, opcode)){
+      if(opcodes.getOpcode(opcode.text, opcode.length) == UNDEFINED){
+	myFormatCorrect = false;
+	break;
+      }
+      k++;
+    }
+  }
+  // the labels were those of skipped instructions
+  myDefinedLabels.clear();
+  myDefinedNames.clear();
+  if(myInput.hasError())
+    myFormatCorrect = false;
+  return k;
 }
 
-void ASMParser::getTokens(string line,
-			       string &opcode,
-			       string *operand,
+void ASMParser::getTokens(const char *line,
+			       size_t length,
+			       size_t readable,
+			       Token &opcode,
+			       Token *operand,
 			       int &numOperands)
-  // Decomposes a line of assembly code into strings for the opcode field and operands, 
-  // checking for syntax errors and counting the number of operands.
+  // Decomposes a line of assembly code, line[0, length), into tokens for the opcode
+  // field and operands, checking for syntax errors and counting the number of operands.
+  // The tokens point into the line; readable bytes may be read from line on.
 {
-    // locate the start of a comment
-    string::size_type idx = line.find('#');
-    if (idx != string::npos) // found a ';'
-	line = line.substr(0,idx);
-    int len = line.length();
-    opcode = "";
+    PerfScope scope(PERF_TOKENIZE);
+
+    opcode.text = line;
+    opcode.length = 0;
     numOperands = 0;
 
+    // Classify the whole line first, one block of LexBlockSize bytes at a
+    // time, in place in the input buffer; token boundaries are then found
+    // by scanning mask bits.
+    const char *text = line;
+    int len = length;
+    int blocks = (len + LexBlockSize - 1) / LexBlockSize;
+    myMasks.resize(blocks);
+    for (int b = 0; b < blocks; b++)
+	classifyBlock(text + b * LexBlockSize,
+		      min((size_t)(len - b * LexBlockSize), LexBlockSize),
+		      readable - b * LexBlockSize, myMasks[b]);
+
+    // Returns the first position at or after p (and before end) whose byte
+    // is (set == true) or is not (set == false) in the class selected by field
+    auto scan = [&](uint64_t DelimiterMasks::*field1, uint64_t DelimiterMasks::*field2,
+		    bool set, int p, int end){
+	while (p < end) {
+	    int b = p / LexBlockSize;
+	    uint64_t m = myMasks[b].*field1;
+	    if (field2)
+		m |= myMasks[b].*field2;
+	    if (!set)
+		m = ~m;
+	    int bit = nextSetBit(m, p % LexBlockSize);
+	    if (bit < 64)
+		return min(end, (int)(b * LexBlockSize) + bit);
+	    p = (b + 1) * LexBlockSize;
+	}
+	return end;
+    };
+    uint64_t DelimiterMasks::*none = NULL;
+
+    // locate the start of a comment
+    len = scan(&DelimiterMasks::hash, none, true, 0, len);
     if (len == 0) return;
-    int p = 0; // position in line
 
-    // line.at(p) is whitespace or p >= len
-    while (p < len && isWhitespace(line.at(p)))
-	p++;
-    // opcode starts
-    while (p < len && !isWhitespace(line.at(p)))
-    {
-	opcode = opcode + line.at(p);
-	p++;
-    }
-    //    for(int i = 0; i < 3; i++){
-    int i = 0;
-    while(p < len){
-      while ( p < len && isWhitespace(line.at(p)))
-	p++;
+    // opcode: the first run of non-whitespace
+    int p = scan(&DelimiterMasks::space, none, false, 0, len);
+    int e = scan(&DelimiterMasks::space, none, true, p, len);
+    opcode.text = text + p;
+    opcode.length = e - p;
+    p = e;
 
-      // operand may start
-      bool flag = false;
-      while (p < len && !isWhitespace(line.at(p)))
-	{
-	  if(line.at(p) != ','){
-	    operand[i] = operand[i] + line.at(p);
-	    flag = true;
-	    p++;
-	  }
-	  else{
-	    p++;
-	    break;
-	  }
-	}
-      if(flag == true){
+    // operands: runs of non-whitespace, each ended early by a comma
+    int i = 0;
+    int lastStart = 0, lastEnd = 0;   // extent of operand[numOperands-1]
+    while(p < len && i < MaxOperands - 1){
+      p = scan(&DelimiterMasks::space, none, false, p, len);
+      e = scan(&DelimiterMasks::space, &DelimiterMasks::comma, true, p, len);
+      if(e > p){
+	operand[i].text = text + p;
+	operand[i].length = e - p;
 	numOperands++;
+	lastStart = p;
+	lastEnd = e;
       }
+      p = e;
+      if(p < len && text[p] == ',')
+	p++;
       i++;
     }
 
+    if (numOperands == 0) return;
+
+    // split a last operand like "100($2)" into offset and register
+    int idx = scan(&DelimiterMasks::lparen, none, true, lastStart, lastEnd);
+    int idx2 = scan(&DelimiterMasks::rparen, none, true, lastStart, lastEnd);
     
-    idx = operand[numOperands-1].find('(');
-    string::size_type idx2 = operand[numOperands-1].find(')');
-    
-    if (idx == string::npos || idx2 == string::npos ||
-	((idx2 - idx) < 2 )){ // no () found
+    if (idx == lastEnd || idx2 == lastEnd || idx2 - idx < 2){ // no () found
     }
     else{ // split string
-      string offset = operand[numOperands-1].substr(0,idx);
-      string regStr = operand[numOperands-1].substr(idx+1, idx2-idx-1);
-      
-      operand[numOperands-1] = offset;
-      operand[numOperands] = regStr;
+      operand[numOperands-1].length = idx - lastStart;
+      operand[numOperands].text = text + idx + 1;
+      operand[numOperands].length = idx2 - idx - 1;
       numOperands++;
     }
-    
-    
 
     // ignore anything after the whitespace after the operand
     // We could do a further look and generate an error message
@@ -149,114 +246,132 @@ void ASMParser::getTokens(string line,
     return;
 }
 
-bool ASMParser::isNumberString(string s)
-  // Returns true if s represents a valid decimal integer
-{
-    int len = s.length();
-    if (len == 0) return false;
-    if ((isSign(s.at(0)) && len > 1) || isDigit(s.at(0)))
-    {
-	// check remaining characters
-	for (int i=1; i < len; i++)
-	{
-	    if (!isdigit(s.at(i))) return false;
-	}
-	return true;
-    }
-    return false;
-}
-
-
-int ASMParser::cvtNumString2Number(string s)
-  // Converts a string to an integer.  Assumes s is something like "-231" and produces -231
+bool ASMParser::isNumberString(const Token &s, int &value)
+  // Returns true if s represents a valid decimal or 0x-prefixed hexadecimal
+  // integer, and stores its value in value
 {
-    if (!isNumberString(s))
-    {
-	cerr << "Non-numberic string passed to cvtNumString2Number"
-		  << endl;
-	return 0;
-    }
-    int k = 1;
-    int val = 0;
-    for (int i = s.length()-1; i>0; i--)
-    {
-	char c = s.at(i);
-	val = val + k*((int)(c - '0'));
-	k = k*10;
-    }
-    if (isSign(s.at(0)))
-    {
-	if (s.at(0) == '-') val = -1*val;
-    }
-    else
-    {
-	val = val + k*((int)(s.at(0) - '0'));
-    }
-    return val;
+    return parseNumber(s.text, s.length, value);
 }
 		
 
 bool ASMParser::getOperands(Instruction &i, Opcode o, 
-			    string *operand, int operand_count)
-  // Given an Opcode, a string representing the operands, and the number of operands, 
+			    const Token *operand, int operand_count)
+  // Given an Opcode, the tokens of the operands, and the number of operands, 
   // breaks operands apart and stores fields into Instruction.
 {
+  PerfScope scope(PERF_OPERANDS);
+
 
   if(operand_count != opcodes.numOperands(o))
     return false;
 
+  return (this->*operandDecoders[o])(i, operand);
+}
+
+
+template<Opcode O>
+bool ASMParser::decodeOperands(Instruction &i, const Token *operand)
+  // Operand decoder specialized for opcode O: only the fields O actually has are
+  // looked up, so no operand positions are tested at run time.
+{
+  constexpr OpcodeInfo info = OpcodeInfoTable[O];
+
   int rs, rt, rd, imm;
   imm = 0;
   rs = rt = rd = NumRegisters;
 
-  int rs_p = opcodes.RSposition(o);
-  int rt_p = opcodes.RTposition(o);
-  int rd_p = opcodes.RDposition(o);
-  int imm_p = opcodes.IMMposition(o);
-
-  if(rs_p != -1){
-    rs = registers.getNum(operand[rs_p]);
+  if constexpr (info.rsPos != -1){
+    rs = registers.getNum(operand[info.rsPos].text, operand[info.rsPos].length);
     if(rs == NumRegisters)
       return false;
   }
 
-  if(rt_p != -1){
-    rt = registers.getNum(operand[rt_p]);
+  if constexpr (info.rtPos != -1){
+    rt = registers.getNum(operand[info.rtPos].text, operand[info.rtPos].length);
     if(rt == NumRegisters)
       return false;
-
   }
   
-  if(rd_p != -1){
-    rd = registers.getNum(operand[rd_p]);
+  if constexpr (info.rdPos != -1){
+    rd = registers.getNum(operand[info.rdPos].text, operand[info.rdPos].length);
     if(rd == NumRegisters)
       return false;
-
   }
 
-  if(imm_p != -1){
-    if(isNumberString(operand[imm_p])){  // does it have a numeric immediate field?
-      imm = cvtNumString2Number(operand[imm_p]);
+  if constexpr (info.immPos != -1){
+    if(isNumberString(operand[info.immPos], imm)){  // does it have a numeric immediate field?
       if(((imm & 0xFFFF0000)<<1))  // too big a number to fit
 	return false;
     }
     else{ 
-      if(opcodes.isIMMLabel(o)){  // Can the operand be a label?
-	// Assign the immediate field an address
-	imm = myLabelAddress;
-	myLabelAddress += 4;  // increment the label generator
+      if constexpr (info.immLabel){  // Can the operand be a label?
+	// Assign the immediate field the label's address
+	imm = getLabelAddress(string(operand[info.immPos].text, operand[info.immPos].length));
       }
       else  // There is an error
 	return false;
     }
-
   }
 
-  i.setValues(o, rs, rt, rd, imm);
+  i.setValues(O, rs, rt, rd, imm);
 
   return true;
 }
 
+int ASMParser::getLabelAddress(const string &name)
+  // Returns the address of the label name, giving it the next free address
+  // if it has not been seen before
+{
+  map<string, int>::iterator it = myLabelAddresses.find(name);
+  if(it != myLabelAddresses.end())
+    return it->second;
+
+  int address = myLabelAddress;
+  myLabelAddress += 4;  // increment the label generator
+  myLabelAddresses.insert(make_pair(name, address));
+  return address;
+}
+
+bool ASMParser::defineLabel(const string &name)
+  // Records the definition of the label name at the next instruction.
+  // Returns false if name is empty or was already defined.
+{
+  if(name.length() == 0)
+    return false;
+
+  int address = getLabelAddress(name);
+  if(!myLabelDefined.insert(address).second)
+    return false;
+  myDefinedLabels.push_back(address);
+  myDefinedNames.push_back(name);
+  return true;
+}
+
+void ASMParser::getLabelState(int &nextAddress, map<string, int> &addresses,
+			      set<int> &defined) const
+  // Copies out the state of the label generator: the next free address,
+  // the address of every label seen and the labels defined
+{
+  nextAddress = myLabelAddress;
+  addresses = myLabelAddresses;
+  defined = myLabelDefined;
+}
+
+void ASMParser::setLabelState(int nextAddress, const map<string, int> &addresses,
+			      const set<int> &defined)
+  // Restores a state of the label generator saved by getLabelState
+{
+  myLabelAddress = nextAddress;
+  myLabelAddresses = addresses;
+  myLabelDefined = defined;
+}
+
+const ASMParser::OperandDecoder ASMParser::operandDecoders[UNDEFINED] = {
+#define OPCODE_DECODER(op, ...) &ASMParser::decodeOperands<op>,
+  OPCODE_LIST(OPCODE_DECODER)
+#undef OPCODE_DECODER
+};
+
 
 string ASMParser::encode(Instruction i)
   // Given a valid instruction, returns a string representing the 32 bit MIPS binary encoding
@@ -8,69 +8,123 @@ using namespace std;
 #include "Instruction.h"
 #include "RegisterTable.h"
 #include "OpcodeTable.h"
+#include "InputStream.h"
+#include "Lexer.h"
 #include <vector>
+#include <map>
+#include <set>
 #include <sstream>
 
-/* This class reads in a MIPS assembly file and checks its syntax.  If
- * the file is syntactically correct, this class will retain a list 
- * of Instructions (one for each instruction from the file).  This
- * list of Instructions can be iterated through.
+/* This class reads in a MIPS assembly file and checks its syntax.  The
+ * file is parsed as it is iterated through: each call to getNextInstruction
+ * reads and decodes one more line, so the whole program is never held in
+ * memory.  The file may be standard input ("-") and may be gzip or zstd
+ * compressed.
+ *
+ * A line may define labels ("loop:"), alone or in front of an instruction.
+ * Every label name is given an address the first time it is used or
+ * defined; a j to the label carries that address as its immediate.
  */
    
 
 class ASMParser{
  public:
-  // Specify a text file containing MIPS assembly instructions. Function
-  // checks syntactic correctness of file and creates a list of Instructions.
-  ASMParser(string filename);
+  // Specify a text file containing MIPS assembly instructions ("-" for
+  // standard input), to be read from byte start on.
+  ASMParser(string filename, uint64_t start = 0);
 
-  // Returns true if the file specified was syntactically correct.  Otherwise,
-  // returns false.
+  // Returns true if the file could be opened and every line read so far was
+  // syntactically correct.  Otherwise, returns false.
   bool isFormatCorrect() { return myFormatCorrect; };
 
-  // Iterator that returns the next Instruction in the list of Instructions.
+  // Iterator that returns the next Instruction in the file.  Returns an
+  // UNDEFINED Instruction at the end of the file or at the first line with
+  // a syntax error (isFormatCorrect then returns false).
   Instruction getNextInstruction();
 
- private:
-  vector<Instruction> myInstructions;      // list of Instructions
-  int myIndex;                             // iterator index
-  bool myFormatCorrect;
-
-  RegisterTable registers;                 // encodings for registers
-  OpcodeTable opcodes;                     // encodings of opcodes
-  int myLabelAddress;   // Used to assign labels addresses
-
-  // Decomposes a line of assembly code into strings for the opcode field and operands, 
-  // checking for syntax errors and counting the number of operands.
-  void getTokens(string line, string &opcode, string *operand, int &num_operands);
+  // Skips the next n instructions without decoding them.  Only their
+  // opcodes and labels are checked: a line whose first word (after any
+  // labels) is not an opcode, or a label defined twice, stops the skip as a
+  // syntax error.  Returns the number skipped, less than n only at the end
+  // of the file or at such a line.
+  long skip(long n);
 
-  // Given an Opcode, a string representing the operands, and the number of operands, 
-  // breaks operands apart and stores fields into Instruction.
-  bool getOperands(Instruction &i, Opcode o, string *operand, int operand_count);
+  // Returns the number of instructions returned by getNextInstruction so
+  // far (not those skipped)
+  uint64_t numReturned() const { return myReturned; };
 
-  // Returns true if character is white space
-  bool isWhitespace(char c)    { return (c == ' '|| c == '\t'); };
+  // Returns the addresses of the labels defined at the instruction last
+  // returned by getNextInstruction
+  const vector<int> &getLabels() const { return myDefinedLabels; };
 
-  // Returns true if character is a digit
-  bool isDigit(char c)         { return (c >= '0' && c <= '9'); };
+  // Returns the names of the same labels, in the same order
+  const vector<string> &getLabelNames() const { return myDefinedNames; };
 
-  // Returns true if character is an uppercase letter
-  bool isAlphaUpper(char c)    { return (c >= 'A' && c <= 'Z'); };
+  // Returns the offset in the file of the line after the instruction last
+  // returned, where a parser created with that start carries on
+  uint64_t tell() { return myInput.tell(); };
 
-  // Returns true if character is a lowercase letter
-  bool isAlphaLower(char c)    { return (c >= 'a' && c <= 'z'); };
+  // Copies out the state of the label generator: the next free address,
+  // the address of every label seen and the labels defined
+  void getLabelState(int &nextAddress, map<string, int> &addresses, set<int> &defined) const;
 
-  // Returns true if character is a plus or minus
-  bool isSign(char c)          { return (c == '-' || c == '+'); };
+  // Restores a state of the label generator saved by getLabelState
+  void setLabelState(int nextAddress, const map<string, int> &addresses,
+		     const set<int> &defined);
 
-  // Returns true if character is an alphabetic character
-  bool isAlpha(char c)         {return (isAlphaUpper(c) || isAlphaLower(c)); };
-  
-  // Returns true if s represents a valid decimal integer
-  bool isNumberString(string s);
+ private:
+  InputStream myInput;                     // source of assembly lines
+  bool myFormatCorrect;
+  uint64_t myReturned;                     // instructions returned
 
-  // Converts a string to an integer.  Assumes s is something like "-231" and produces -231
-  int  cvtNumString2Number(string s);
+  RegisterTable registers;                 // encodings for registers
+  OpcodeTable opcodes;                     // encodings of opcodes
+  int myLabelAddress;   // Used to assign labels addresses
+  map<string, int> myLabelAddresses;       // address of every label seen
+  set<int> myLabelDefined;                 // labels defined so far
+  vector<int> myDefinedLabels;             // labels at the current instruction
+  vector<string> myDefinedNames;           // and their names
+  vector<DelimiterMasks> myMasks;          // classification of the current line
+
+  // Largest number of operands on one line
+  static const int MaxOperands = 80;
+
+  // Decomposes a line of assembly code, line[0, length), into tokens for the opcode
+  // field and operands, checking for syntax errors and counting the number of operands.
+  // The tokens point into the line; readable bytes may be read from line on.
+  void getTokens(const char *line, size_t length, size_t readable,
+		 Token &opcode, Token *operand, int &num_operands);
+
+  // Given an Opcode, the tokens of the operands, and the number of operands, 
+  // breaks operands apart and stores fields into Instruction.
+  bool getOperands(Instruction &i, Opcode o, const Token *operand, int operand_count);
+
+  // Operand decoder specialized for opcode O: only the fields O actually has are
+  // looked up, so no operand positions are tested at run time.
+  template<Opcode O>
+  bool decodeOperands(Instruction &i, const Token *operand);
+
+  // Jump table of decodeOperands<O>, one entry per Opcode
+  typedef bool (ASMParser::*OperandDecoder)(Instruction &i, const Token *operand);
+  static const OperandDecoder operandDecoders[UNDEFINED];
+
+  // Returns true if s represents a valid decimal or 0x-prefixed hexadecimal
+  // integer, and stores its value in value
+  bool isNumberString(const Token &s, int &value);
+
+  // Returns the address of the label name, giving it the next free address
+  // if it has not been seen before
+  int getLabelAddress(const string &name);
+
+  // Records the definition of the label name at the next instruction.
+  // Returns false if name is empty or was already defined.
+  bool defineLabel(const string &name);
+
+  // Defines the labels in front of line[0, n) and sets opcode to the word
+  // after them.  Returns true if there is one, false for a line of just
+  // labels, blanks or a comment, or at a label defined twice (which is a
+  // syntax error).
+  bool skipLabels(const char *line, size_t n, Token &opcode);
 
 
   // Given a valid instruction, returns a string representing the 32 bit MIPS binary encoding
@@ -0,0 +1,200 @@
+#include "BinaryParser.h"
+#include "PerfCounters.h"
+#include <elf.h>
+#include <string.h>
+#include <algorithm>
+
+// Reads an n byte unsigned value stored in the given byte order
+static uint64_t readValue(const char *p, int n, ByteOrder order)
+{
+  uint64_t v = 0;
+  for(int k = 0; k < n; k++){
+    int b = (order == BYTES_LITTLE_ENDIAN) ? n - 1 - k : k;
+    v = (v << 8) | (unsigned char)p[b];
+  }
+  return v;
+}
+
+BinaryParser::BinaryParser(string filename, ByteOrder order, bool elfText, long offset)
+  // Reads the words of filename in the given byte order, skipping offset bytes.
+  // If elfText is true, filename must be an ELF object: the words come from its
+  // .text section (in the byte order recorded in the ELF header) and offset is
+  // relative to the start of that section.
+{
+  myIndex = 0;
+  myReturned = 0;
+  myNextTarget = 0;
+  myFormatCorrect = true;
+  myDisassembly = true;
+
+  InputStream in(filename);
+  if(!in.isOpen()){
+    myFormatCorrect = false;
+    return;
+  }
+  vector<char> buf;
+  size_t got;
+  do{
+    size_t used = buf.size();
+    buf.resize(used + (1 << 20));
+    got = in.read(&buf[used], 1 << 20);
+    buf.resize(used + got);
+  } while(got > 0);
+  if(in.hasError()){
+    myFormatCorrect = false;
+    return;
+  }
+
+  size_t start = 0;
+  size_t length = buf.size();
+  if(elfText && !findTextSection(buf, start, length, order)){
+    myFormatCorrect = false;
+    return;
+  }
+  if(offset < 0 || (size_t)offset > length || (length - offset) % 4 != 0){
+    myFormatCorrect = false;
+    return;
+  }
+  start += offset;
+  length -= offset;
+
+  // Decode every word once, validating them as we go
+  PerfScope scope(PERF_DECODE);
+  myDecoded.resize(length / 4);
+  const unsigned char *p = (const unsigned char *)&buf[0] + start;
+  Instruction scratch;
+  for(size_t k = 0; k < myDecoded.size(); k++, p += 4){
+    uint32_t w;
+    if(order == BYTES_LITTLE_ENDIAN)
+      w = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+    else
+      w = ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+    if(!decode(w, scratch)){
+      myFormatCorrect = false;
+      myDecoded.clear();
+      return;
+    }
+    Decoded &d = myDecoded[k];
+    d.opcode = scratch.getOpcode();
+    d.rs = scratch.getRS();
+    d.rt = scratch.getRT();
+    d.rd = scratch.getRD();
+    d.imm = scratch.getImmediate();
+    if(scratch.getOpcode() == J){
+      // only targets inside the image become labels
+      long target = scratch.getImmediate() - (long)TextBase;
+      if(target >= 0 && target % 4 == 0 && (size_t)(target / 4) < myDecoded.size())
+	myTargets.push_back(target / 4);
+    }
+  }
+  sort(myTargets.begin(), myTargets.end());
+  myTargets.erase(unique(myTargets.begin(), myTargets.end()), myTargets.end());
+}
+
+
+Instruction BinaryParser::getNextInstruction()
+  // Iterator that returns the next Instruction in the image.
+{
+  Instruction i;
+  myLabels.clear();
+  if(myIndex < myDecoded.size()){
+    if(myNextTarget < myTargets.size() && myTargets[myNextTarget] == myIndex){
+      myLabels.push_back(TextBase + 4 * myIndex);
+      myNextTarget++;
+    }
+    const Decoded &d = myDecoded[myIndex];
+    i.setValues((Opcode)d.opcode, d.rs, d.rt, d.rd, d.imm);
+    if(myDisassembly)
+      i.setAssembly(disassemble(i));
+    myIndex++;
+    myReturned++;
+  }
+  return i;
+}
+
+
+long BinaryParser::skip(long n)
+  // Skips the next n instructions.  Returns the number skipped, less than n
+  // only at the end of the image.
+{
+  long k = min((size_t)max(n, 0L), myDecoded.size() - myIndex);
+  myIndex += k;
+  while(myNextTarget < myTargets.size() && myTargets[myNextTarget] < myIndex)
+    myNextTarget++;
+  myLabels.clear();
+  return k;
+}
+
+
+bool BinaryParser::findTextSection(const vector<char> &buf, size_t &start,
+				   size_t &length, ByteOrder &order)
+  // Locates the .text section of the ELF image in buf.  Sets start and length
+  // and the byte order of the file.  Returns false if buf is not a valid ELF.
+{
+  if(buf.size() < EI_NIDENT || memcmp(&buf[0], ELFMAG, SELFMAG) != 0)
+    return false;
+
+  bool is64 = (buf[EI_CLASS] == ELFCLASS64);
+  if(!is64 && buf[EI_CLASS] != ELFCLASS32)
+    return false;
+  if(buf[EI_DATA] == ELFDATA2MSB)
+    order = BYTES_BIG_ENDIAN;
+  else if(buf[EI_DATA] == ELFDATA2LSB)
+    order = BYTES_LITTLE_ENDIAN;
+  else
+    return false;
+
+  size_t ehsize = is64 ? sizeof(Elf64_Ehdr) : sizeof(Elf32_Ehdr);
+  if(buf.size() < ehsize)
+    return false;
+
+  // Offsets of the fields we need in the ELF and section headers
+  const char *h = &buf[0];
+  uint64_t shoff    = is64 ? readValue(h + 40, 8, order) : readValue(h + 32, 4, order);
+  uint64_t shentsz  = readValue(h + (is64 ? 58 : 46), 2, order);
+  uint64_t shnum    = readValue(h + (is64 ? 60 : 48), 2, order);
+  uint64_t shstrndx = readValue(h + (is64 ? 62 : 50), 2, order);
+  uint64_t shminsz  = is64 ? sizeof(Elf64_Shdr) : sizeof(Elf32_Shdr);
+  // every header must fit in the file; the sums here could wrap around, so
+  // the comparisons are written without them
+  uint64_t size = buf.size();
+  if(shoff == 0 || shentsz < shminsz || shstrndx >= shnum ||
+     shoff > size || shnum > (size - shoff) / shentsz)
+    return false;
+
+  // Returns the offset and size of section k
+  auto section = [&](uint64_t k, uint64_t &off, uint64_t &size){
+    const char *s = h + shoff + k * shentsz;
+    off  = is64 ? readValue(s + 24, 8, order) : readValue(s + 16, 4, order);
+    size = is64 ? readValue(s + 32, 8, order) : readValue(s + 20, 4, order);
+  };
+
+  uint64_t strOff, strSize;
+  section(shstrndx, strOff, strSize);
+  if(strOff > size || strSize > size - strOff)
+    return false;
+
+  for(uint64_t k = 0; k < shnum; k++){
+    uint64_t nameIdx = readValue(h + shoff + k * shentsz, 4, order);
+    if(nameIdx > strSize || strSize - nameIdx < 6 ||
+       memcmp(h + strOff + nameIdx, ".text", 6) != 0)
+      continue;
+    uint64_t off, bytes;
+    section(k, off, bytes);
+    if(off > size || bytes > size - off)
+      return false;
+    start = off;
+    length = bytes;
+    return true;
+  }
+  return false;
+}
+
+
+string BinaryParser::disassemble(const Instruction &i)
+  // Returns the assembly form of a decoded instruction, e.g. "lb $1, 100($2)"
+{
+  OpcodeTable opcodes;
+  return opcodes.toAssembly(i.getOpcode(), i.getRS(), i.getRT(), i.getRD(),
+			    i.getImmediate());
+}
@@ -0,0 +1,166 @@
+#ifndef __BINARYPARSER_H__
+#define __BINARYPARSER_H__
+
+using namespace std;
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include "Instruction.h"
+#include "RegisterTable.h"
+#include "OpcodeTable.h"
+#include "InputStream.h"
+
+/* This class reads a flat binary image of 32 bit MIPS machine words (or the
+ * .text section of an ELF object) and decodes every word into an Instruction
+ * using only bit operations.  The words are decoded (and validated) once,
+ * when the image is read, into compact records; the assembly text of an
+ * instruction is built only if it is wanted.  The image may come from
+ * standard input ("-") and may be compressed (see InputStream).  It can be
+ * iterated through exactly like ASMParser.
+ */
+
+// Byte order of the words in a binary image
+enum ByteOrder {
+  BYTES_LITTLE_ENDIAN,
+  BYTES_BIG_ENDIAN
+};
+
+// Maps the opcode field (or 64 + funct field when opcode is 0) to an Opcode.
+// Built at compile time from OpcodeInfoTable.
+struct MachineDecodeTable {
+  Opcode entry[128];
+
+  constexpr MachineDecodeTable() : entry() {
+    for(int k = 0; k < 128; k++)
+      entry[k] = UNDEFINED;
+    for(int o = 0; o < (int)UNDEFINED; o++){
+      const OpcodeInfo &info = OpcodeInfoTable[o];
+      if(info.functBits == -1)
+	entry[info.opBits] = (Opcode)o;
+      else
+	entry[64 + info.functBits] = (Opcode)o;
+    }
+  }
+};
+
+inline constexpr MachineDecodeTable MachineDecoder;
+
+// Address the first word of an image is assumed to be loaded at; jump
+// targets are resolved against it
+const int TextBase = 0x400000;
+
+
+class BinaryParser{
+ public:
+  // Reads the words of filename in the given byte order, skipping offset bytes.
+  // If elfText is true, filename must be an ELF object: the words come from its
+  // .text section (in the byte order recorded in the ELF header) and offset is
+  // relative to the start of that section.
+  BinaryParser(string filename, ByteOrder order = BYTES_LITTLE_ENDIAN,
+	       bool elfText = false, long offset = 0);
+
+  // Returns true if the file could be read and every word decodes to a
+  // supported instruction.  Otherwise, returns false.
+  bool isFormatCorrect() { return myFormatCorrect; };
+
+  // Iterator that returns the next Instruction in the image.
+  Instruction getNextInstruction();
+
+  // Sets whether the instructions returned carry their assembly text (the
+  // default); without it getAssembly() of each is empty
+  void setDisassembly(bool on) { myDisassembly = on; };
+
+  // Skips the next n instructions.  Returns the number skipped, less than n
+  // only at the end of the image.
+  long skip(long n);
+
+  // Returns the number of instructions returned by getNextInstruction so
+  // far (not those skipped)
+  uint64_t numReturned() const { return myReturned; };
+
+  // Returns the addresses of the jump targets at the instruction last
+  // returned by getNextInstruction (the image has no label names)
+  const vector<int> &getLabels() const { return myLabels; };
+
+  // Returns the number of instructions returned or skipped so far
+  size_t tell() { return myIndex; };
+
+  // Returns the number of instructions in the image
+  size_t size() { return myDecoded.size(); };
+
+  // Decodes a 32 bit MIPS word into i.  Returns false if the word is not one
+  // of the supported instructions, or has bits set in a field the
+  // instruction does not use (e.g. rs of mflo).
+  static bool decode(uint32_t word, Instruction &i);
+
+  // Returns the assembly form of a decoded instruction, e.g. "lb $1, 100($2)"
+  static string disassemble(const Instruction &i);
+
+ private:
+  // The fields of a decoded word
+  struct Decoded {
+    uint8_t opcode;
+    uint8_t rs, rt, rd;         // NumRegisters when not used
+    int32_t imm;
+  };
+
+  vector<Decoded> myDecoded;  // one per word of the image
+  size_t myIndex;             // iterator index
+  uint64_t myReturned;        // instructions returned
+  bool myDisassembly;         // instructions carry their text
+  vector<size_t> myTargets;   // sorted indices of the words jumped to
+  size_t myNextTarget;        // first entry of myTargets not yet reached
+  vector<int> myLabels;       // jump targets at the current instruction
+  bool myFormatCorrect;
+
+  // Locates the .text section of the ELF image in buf.  Sets start and length
+  // and the byte order of the file.  Returns false if buf is not a valid ELF.
+  bool findTextSection(const vector<char> &buf, size_t &start, size_t &length,
+		       ByteOrder &order);
+};
+
+
+inline bool BinaryParser::decode(uint32_t word, Instruction &i)
+  // Decodes a 32 bit MIPS word into i.  Returns false if the word is not one
+  // of the supported instructions, or has bits set in a field the
+  // instruction does not use (e.g. rs of mflo).
+{
+  uint32_t op = word >> 26;
+  uint32_t funct = word & 0x3f;
+  Opcode o = MachineDecoder.entry[op ? op : 64 | funct];
+  if(o == UNDEFINED)
+    return false;
+
+  const OpcodeInfo &info = OpcodeInfoTable[o];
+  Register rs = (word >> 21) & 0x1f;
+  Register rt = (word >> 16) & 0x1f;
+  Register rd = (word >> 11) & 0x1f;
+  int imm;
+  if(info.instType == JTYPE)
+    imm = (word & 0x3ffffff) << 2;            // jump target address
+  else if(info.instType == RTYPE)
+    imm = (word >> 6) & 0x1f;                 // shamt
+  else
+    imm = (int16_t)(word & 0xffff);           // sign extended immediate
+
+  // the register fields of a jump are part of its target; in other
+  // instructions unused fields must be zero
+  if(info.instType != JTYPE &&
+     ((info.rsPos == -1 && rs != 0) || (info.rtPos == -1 && rt != 0)))
+    return false;
+  if(info.instType == RTYPE &&
+     ((info.rdPos == -1 && rd != 0) || (info.immPos == -1 && imm != 0)))
+    return false;
+
+  i.setValues(o,
+	      info.rsPos != -1 ? rs : NumRegisters,
+	      info.rtPos != -1 ? rt : NumRegisters,
+	      info.rdPos != -1 ? rd : NumRegisters,
+	      info.immPos != -1 ? imm : 0);
+  return true;
+}
+
+#endif
@@ -0,0 +1,390 @@
+#include "Checkpoint.h"
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+static const char Magic[8] = { 'D', 'C', 'H', 'K', 'C', 'K', 'P', '2' };
+
+// Start value of hashBytes
+static const uint64_t HashSeed = 0xcbf29ce484222325ULL;
+
+static const char InstructionHeader[] = "INSTRUCTIONS:\n";
+static const char DependenceHeader[] = "DEPENDENCES: \nType Register (FirstInstr#, SecondInstr#) \n";
+
+// Writes n bytes at p to fd.  Returns false on error.
+static bool writeAll(int fd, const char *p, size_t n)
+{
+  while(n > 0){
+    ssize_t w = ::write(fd, p, n);
+    if(w < 0 && errno == EINTR)
+      continue;
+    if(w <= 0)
+      return false;
+    p += w;
+    n -= w;
+  }
+  return true;
+}
+
+// Copies the file at path to fd.  Returns false on error.
+static bool copyFile(const string &path, int fd)
+{
+  int in = open(path.c_str(), O_RDONLY);
+  if(in < 0)
+    return false;
+  vector<char> buf(1 << 20);
+  bool ok = true;
+  while(ok){
+    ssize_t r = ::read(in, &buf[0], buf.size());
+    if(r < 0 && errno == EINTR)
+      continue;
+    if(r <= 0){
+      ok = (r == 0);
+      break;
+    }
+    ok = writeAll(fd, &buf[0], r);
+  }
+  close(in);
+  return ok;
+}
+
+// Syncs the directory holding path, so a file renamed into it stays there
+static bool syncDirectory(const string &path)
+{
+  size_t slash = path.rfind('/');
+  string directory = (slash == string::npos) ? "." : path.substr(0, max(slash, (size_t)1));
+  int fd = open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+  if(fd < 0)
+    return false;
+  bool ok = (fsync(fd) == 0);
+  close(fd);
+  return ok;
+}
+
+// Returns h updated with bytes [p, p + n) (64 bit FNV-1a)
+static uint64_t hashBytes(uint64_t h, const char *p, size_t n)
+{
+  for(size_t k = 0; k < n; k++)
+    h = (h ^ (unsigned char)p[k]) * 0x100000001b3ULL;
+  return h;
+}
+
+// Appends v to out, least significant byte first
+static void putNumber(string &out, uint64_t v)
+{
+  for(int b = 0; b < 8; b++)
+    out.push_back((char)(v >> (8 * b)));
+}
+
+// Reads a number written by putNumber at p, which must be before end
+static bool getNumber(const char *&p, const char *end, uint64_t &v)
+{
+  if(end - p < 8)
+    return false;
+  v = 0;
+  for(int b = 0; b < 8; b++)
+    v |= (uint64_t)(unsigned char)p[b] << (8 * b);
+  p += 8;
+  return true;
+}
+
+
+Checkpointer::Checkpointer(const string &path, const string &input, const string &options)
+  // Keeps checkpoints at path and the report in path.text and path.deps, of
+  // the report of input ("-" for standard input) parsed with options
+  : myPath(path), myInput(input), myOptions(options)
+{
+  myTextFd = myDependenceFd = -1;
+  myError = false;
+  myWriting = false;
+  myStop = false;
+  myHashed = 0;
+  myHash = HashSeed;
+  if(myInput != "-")
+    myHashStream.reset(new InputStream(myInput));
+}
+
+Checkpointer::~Checkpointer()
+  // Waits for the checkpoints still being written
+{
+  {
+    lock_guard<mutex> guard(myLock);
+    myStop = true;
+  }
+  myQueued.notify_all();
+  if(myWriter.joinable())
+    myWriter.join();
+  if(myTextFd >= 0)
+    close(myTextFd);
+  if(myDependenceFd >= 0)
+    close(myDependenceFd);
+}
+
+bool Checkpointer::start()
+  // Starts a new run, emptying the report files.  Returns false if they
+  // cannot be created.
+{
+  unlink(myPath.c_str());
+  myTextFd = open((myPath + ".text").c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  myDependenceFd = open((myPath + ".deps").c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if(myTextFd < 0 || myDependenceFd < 0)
+    return false;
+  myWriter = thread(&Checkpointer::writerLoop, this);
+  return true;
+}
+
+ResumeResult Checkpointer::resume(CheckpointState &state)
+  // Loads the last checkpoint into state and truncates the report files to
+  // it.  Does nothing unless the checkpoint is of the same input.
+{
+  int fd = open(myPath.c_str(), O_RDONLY);
+  if(fd < 0)
+    return NO_CHECKPOINT;
+  string bytes;
+  char buf[4096];
+  ssize_t r;
+  while((r = ::read(fd, buf, sizeof(buf))) > 0)
+    bytes.append(buf, r);
+  close(fd);
+  if(r < 0 || !decode(bytes, state))
+    return NO_CHECKPOINT;
+
+  // this also hashes the input read so far, which later checkpoints go on from
+  CheckpointState now;
+  now.prefixBytes = state.prefixBytes;
+  if(!fingerprint(now) || now.options != state.options ||
+     now.inputSize != state.inputSize || now.inputTime != state.inputTime ||
+     now.prefixBytes != state.prefixBytes || now.prefixHash != state.prefixHash)
+    return OTHER_INPUT;
+
+  // lines written after the checkpoint are written again
+  myTextFd = open((myPath + ".text").c_str(), O_WRONLY);
+  myDependenceFd = open((myPath + ".deps").c_str(), O_WRONLY);
+  if(myTextFd < 0 || myDependenceFd < 0 ||
+     lseek(myTextFd, 0, SEEK_END) < (off_t)state.textBytes ||
+     lseek(myDependenceFd, 0, SEEK_END) < (off_t)state.dependenceBytes ||
+     ftruncate(myTextFd, state.textBytes) != 0 ||
+     ftruncate(myDependenceFd, state.dependenceBytes) != 0 ||
+     lseek(myTextFd, 0, SEEK_END) < 0 || lseek(myDependenceFd, 0, SEEK_END) < 0)
+    return NO_CHECKPOINT;
+  myWriter = thread(&Checkpointer::writerLoop, this);
+  return RESUMED;
+}
+
+void Checkpointer::save(string &text, string &dependences, const CheckpointState &state)
+  // Queues text and dependences (the report lines since the last save,
+  // which are taken and left empty) and state, the state after them.  They
+  // are written on the background thread; this waits only when two earlier
+  // checkpoints are still being written.
+{
+  Job job;
+  job.text.swap(text);
+  job.dependences.swap(dependences);
+  job.state = state;
+
+  unique_lock<mutex> guard(myLock);
+  myDone.wait(guard, [this]{ return myJobs.size() < MaxPending; });
+  myJobs.push_back(move(job));
+  guard.unlock();
+  myQueued.notify_one();
+}
+
+bool Checkpointer::finish(int fd)
+  // Waits for every checkpoint to be written, prints the report to fd and
+  // removes the checkpoint files.  Returns false if anything could not be
+  // written.
+{
+  drain();
+  if(myError)
+    return false;
+
+  bool ok = writeAll(fd, InstructionHeader, strlen(InstructionHeader)) &&
+    copyFile(myPath + ".text", fd) &&
+    writeAll(fd, DependenceHeader, strlen(DependenceHeader)) &&
+    copyFile(myPath + ".deps", fd);
+  if(ok){
+    unlink(myPath.c_str());
+    unlink((myPath + ".text").c_str());
+    unlink((myPath + ".deps").c_str());
+  }
+  return ok;
+}
+
+
+void Checkpointer::writerLoop()
+  // Body of the background thread
+{
+  unique_lock<mutex> guard(myLock);
+  while(true){
+    myQueued.wait(guard, [this]{ return !myJobs.empty() || myStop; });
+    if(myJobs.empty())
+      return;
+    myWriting = true;
+    guard.unlock();
+    bool ok = write(myJobs.front());
+    guard.lock();
+    if(!ok)
+      myError = true;
+    myJobs.pop_front();
+    myWriting = false;
+    myDone.notify_all();
+  }
+}
+
+bool Checkpointer::write(Job &job)
+  // Appends the lines of job and replaces the checkpoint file
+{
+  if(!writeAll(myTextFd, job.text.data(), job.text.size()) ||
+     !writeAll(myDependenceFd, job.dependences.data(), job.dependences.size()) ||
+     fdatasync(myTextFd) != 0 || fdatasync(myDependenceFd) != 0 ||
+     !fingerprint(job.state))
+    return false;
+
+  // the old checkpoint stays valid until the new one is complete
+  string temporary = myPath + ".tmp";
+  string bytes = encode(job.state);
+  int fd = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if(fd < 0)
+    return false;
+  bool ok = writeAll(fd, bytes.data(), bytes.size()) && fsync(fd) == 0;
+  close(fd);
+  return ok && rename(temporary.c_str(), myPath.c_str()) == 0 && syncDirectory(myPath);
+}
+
+bool Checkpointer::fingerprint(CheckpointState &state)
+  // Sets the fingerprint of the input in state, hashing it up to
+  // state.prefixBytes.  Returns false if the input cannot be read.
+{
+  state.options = myOptions;
+  state.inputSize = 0;
+  state.inputTime = 0;
+  struct stat st;
+  if(myInput != "-" && stat(myInput.c_str(), &st) == 0){
+    state.inputSize = st.st_size;
+    state.inputTime = st.st_mtim.tv_sec * (int64_t)1000000000 + st.st_mtim.tv_nsec;
+  }
+
+  if(myHashStream){
+    if(!myHashStream->isOpen())
+      return false;
+    vector<char> buf(1 << 20);
+    while(myHashed < state.prefixBytes){
+      size_t n = min((uint64_t)buf.size(), state.prefixBytes - myHashed);
+      size_t got = myHashStream->read(&buf[0], n);
+      myHash = hashBytes(myHash, &buf[0], got);
+      myHashed += got;
+      if(got < n)
+	break;       // the end of the input
+    }
+    if(myHashStream->hasError())
+      return false;
+    state.prefixBytes = myHashed;
+  }
+  state.prefixHash = myHash;
+  return true;
+}
+
+void Checkpointer::drain()
+  // Waits until every queued job is written
+{
+  unique_lock<mutex> guard(myLock);
+  myDone.wait(guard, [this]{ return myJobs.empty() && !myWriting; });
+}
+
+
+string Checkpointer::encode(const CheckpointState &state)
+  // Converts a state to the bytes of the checkpoint file
+{
+  string out(Magic, sizeof(Magic));
+  putNumber(out, state.inputOffset);
+  putNumber(out, state.instructions);
+  putNumber(out, state.textBytes);
+  putNumber(out, state.dependenceBytes);
+
+  putNumber(out, state.options.size());
+  out += state.options;
+  putNumber(out, state.inputSize);
+  putNumber(out, state.inputTime);
+  putNumber(out, state.prefixBytes);
+  putNumber(out, state.prefixHash);
+
+  putNumber(out, state.registers.size());
+  for(const RegisterInfo &r : state.registers){
+    putNumber(out, (int64_t)r.lastInstructionToAccess);
+    putNumber(out, r.accessType);
+  }
+
+  putNumber(out, state.nextLabelAddress);
+  putNumber(out, state.labelAddresses.size());
+  for(auto &l : state.labelAddresses){
+    putNumber(out, l.first.size());
+    out += l.first;
+    putNumber(out, l.second);
+  }
+  putNumber(out, state.labelsDefined.size());
+  for(int address : state.labelsDefined)
+    putNumber(out, address);
+  return out;
+}
+
+bool Checkpointer::decode(const string &bytes, CheckpointState &state)
+  // Converts the bytes of a checkpoint file to a state.  Returns false if
+  // they are not a complete checkpoint.
+{
+  const char *p = bytes.data();
+  const char *end = p + bytes.size();
+  if(bytes.size() < sizeof(Magic) || memcmp(p, Magic, sizeof(Magic)) != 0)
+    return false;
+  p += sizeof(Magic);
+
+  uint64_t v, n;
+  if(!getNumber(p, end, state.inputOffset) || !getNumber(p, end, v))
+    return false;
+  state.instructions = v;
+  if(!getNumber(p, end, state.textBytes) || !getNumber(p, end, state.dependenceBytes) ||
+     !getNumber(p, end, n) || (uint64_t)(end - p) < n)
+    return false;
+  state.options.assign(p, n);
+  p += n;
+  if(!getNumber(p, end, state.inputSize) || !getNumber(p, end, v) ||
+     !getNumber(p, end, state.prefixBytes) || !getNumber(p, end, state.prefixHash) ||
+     !getNumber(p, end, n) || n > NumRegisters)
+    return false;
+  state.inputTime = (int64_t)v;
+
+  state.registers.resize(n);
+  for(RegisterInfo &r : state.registers){
+    if(!getNumber(p, end, v))
+      return false;
+    r.lastInstructionToAccess = (int64_t)v;
+    if(!getNumber(p, end, v) || v > A_UNDEFINED)
+      return false;
+    r.accessType = (AccessType)v;
+  }
+
+  if(!getNumber(p, end, v) || !getNumber(p, end, n))
+    return false;
+  state.nextLabelAddress = v;
+  state.labelAddresses.clear();
+  for(uint64_t k = 0; k < n; k++){
+    uint64_t length;
+    if(!getNumber(p, end, length) || (uint64_t)(end - p) < length)
+      return false;
+    string name(p, length);
+    p += length;
+    if(!getNumber(p, end, v))
+      return false;
+    state.labelAddresses[name] = v;
+  }
+  if(!getNumber(p, end, n))
+    return false;
+  state.labelsDefined.clear();
+  for(uint64_t k = 0; k < n; k++){
+    if(!getNumber(p, end, v))
+      return false;
+    state.labelsDefined.insert(v);
+  }
+  return p == end;
+}
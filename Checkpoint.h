@@ -0,0 +1,154 @@
+#ifndef __CHECKPOINT_H__
+#define __CHECKPOINT_H__
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <stdint.h>
+
+using namespace std;
+
+#include "DependencyChecker.h"
+#include "InputStream.h"
+
+// Everything needed to continue an interrupted report
+struct CheckpointState {
+  uint64_t inputOffset;          // ASM: bytes of input read; binary: instructions
+  int instructions;              // instructions checked
+  vector<RegisterInfo> registers;   // the checker's register table
+
+  // label generator of ASMParser
+  int nextLabelAddress;
+  map<string, int> labelAddresses;
+  set<int> labelsDefined;
+
+  // lengths of the report files that belong to this checkpoint
+  uint64_t textBytes;
+  uint64_t dependenceBytes;
+
+  // bytes of (uncompressed) input the state depends on; all of it if more
+  // than there are
+  uint64_t prefixBytes;
+
+  // the input the checkpoint was taken of, filled in by Checkpointer
+  string options;                // how it was parsed
+  uint64_t inputSize;            // size and modification time (ns) of the
+  int64_t inputTime;             // file, 0 for standard input
+  uint64_t prefixHash;           // hash of its first prefixBytes bytes
+
+  CheckpointState() : inputOffset(0), instructions(0), nextLabelAddress(0),
+		      textBytes(0), dependenceBytes(0), prefixBytes(0),
+		      inputSize(0), inputTime(0), prefixHash(0) {};
+};
+
+// Outcome of Checkpointer::resume
+enum ResumeResult {
+  RESUMED,
+  NO_CHECKPOINT,           // none, or not a complete one
+  OTHER_INPUT              // taken of another input or with other options
+};
+
+/* Keeps a long report run restartable.  The report is built in two files
+ * next to the checkpoint file path: path.text gets the instruction lines
+ * and path.deps the dependence lines, as they are produced.  Every so
+ * often the caller hands over the lines produced since the last time
+ * together with the state after them; a background thread appends the
+ * lines, syncs them to disk and then replaces path with the new state (by
+ * renaming a temporary file), so path always describes data that is on
+ * disk.  A resumed run truncates the two files to the lengths in path and
+ * continues from its state.  finish prints the report from the files,
+ * byte for byte what an uninterrupted run prints, and removes them.
+ *
+ * A checkpoint also records the parser options and the size, modification
+ * time and a hash of the part of the input already read, and is resumed
+ * only for the same.  The hash is kept up to date by reading the input a
+ * second time on the background thread; standard input cannot be read
+ * again, so only its options are checked.
+ */
+class Checkpointer {
+ public:
+  // Keeps checkpoints at path and the report in path.text and path.deps, of
+  // the report of input ("-" for standard input) parsed with options
+  Checkpointer(const string &path, const string &input, const string &options);
+
+  // Waits for the checkpoints still being written
+  ~Checkpointer();
+
+  // Starts a new run, emptying the report files.  Returns false if they
+  // cannot be created.
+  bool start();
+
+  // Loads the last checkpoint into state and truncates the report files to
+  // it.  Does nothing unless the checkpoint is of the same input.
+  ResumeResult resume(CheckpointState &state);
+
+  // Queues text and dependences (the report lines since the last save,
+  // which are taken and left empty) and state, the state after them.  They
+  // are written on the background thread; this waits only when two earlier
+  // checkpoints are still being written.
+  void save(string &text, string &dependences, const CheckpointState &state);
+
+  // Waits for every checkpoint to be written, prints the report to fd and
+  // removes the checkpoint files.  Returns false if anything could not be
+  // written.
+  bool finish(int fd);
+
+ private:
+  // A checkpoint waiting to be written
+  struct Job {
+    string text;
+    string dependences;
+    CheckpointState state;
+  };
+
+  static const size_t MaxPending = 2;
+
+  string myPath;
+  string myInput;
+  string myOptions;
+  int myTextFd;
+  int myDependenceFd;
+  bool myError;
+
+  mutex myLock;
+  condition_variable myQueued;     // signalled when a job is queued
+  condition_variable myDone;       // signalled when a job is written
+  deque<Job> myJobs;
+  bool myWriting;                  // the writer is working on a job
+  bool myStop;
+  thread myWriter;
+
+  // The input read again for its hash (background thread only), or null
+  // for standard input
+  unique_ptr<InputStream> myHashStream;
+  uint64_t myHashed;               // bytes hashed
+  uint64_t myHash;
+
+  // Body of the background thread
+  void writerLoop();
+
+  // Appends the lines of job and replaces the checkpoint file
+  bool write(Job &job);
+
+  // Sets the fingerprint of the input in state, hashing it up to
+  // state.prefixBytes.  Returns false if the input cannot be read.
+  bool fingerprint(CheckpointState &state);
+
+  // Waits until every queued job is written
+  void drain();
+
+  // Converts a state to the bytes of the checkpoint file
+  static string encode(const CheckpointState &state);
+
+  // Converts the bytes of a checkpoint file to a state.  Returns false if
+  // they are not a complete checkpoint.
+  static bool decode(const string &bytes, CheckpointState &state);
+};
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef __CHUNKEDARRAY_H__
+#define __CHUNKEDARRAY_H__
+
+#include <atomic>
+#include <vector>
+#include <stddef.h>
+
+using namespace std;
+
+/* An append-only array whose elements never move once written, so one
+ * thread can append while other threads read.  Elements live in chunks of
+ * ChunkLength.  When the directory of chunks fills it is replaced by a
+ * larger copy; old directories are kept until the array is cleared or
+ * destroyed, so a reader holding any of them still finds valid chunks.
+ *
+ * The array does not publish its length itself: the owner publishes a
+ * count with a release store after appending, and readers only read
+ * elements below a count they loaded with an acquire load.  Appending,
+ * size, back and clear are for the writing thread only.
+ */
+template<class T, size_t ChunkLength = 4096>
+class ChunkedArray {
+ public:
+  // Creates an empty array
+  ChunkedArray() : myDirectory(NULL), myDirectoryLength(0), mySize(0) {};
+
+  ~ChunkedArray() { clear(); };
+
+  // Appends v.  Writer only.
+  void push_back(const T &v);
+
+  // Returns element k.  Any thread, for k below a published count.
+  const T &operator[](size_t k) const {
+    T **directory = myDirectory.load(memory_order_acquire);
+    return directory[k / ChunkLength][k % ChunkLength];
+  };
+
+  // Returns the last element.  Writer only.
+  T &back() {
+    return myDirectory.load(memory_order_relaxed)[(mySize - 1) / ChunkLength]
+      [(mySize - 1) % ChunkLength];
+  };
+
+  // Returns the number of elements.  Writer only.
+  size_t size() const { return mySize; };
+
+  // Removes every element.  Writer only, with no readers left.
+  void clear();
+
+  // Returns the number of bytes allocated
+  size_t memoryUsage() const {
+    return ((mySize + ChunkLength - 1) / ChunkLength) * ChunkLength * sizeof(T) +
+      myDirectoryLength * sizeof(T *);
+  };
+
+ private:
+  atomic<T **> myDirectory;
+  size_t myDirectoryLength;
+  size_t mySize;
+  vector<T **> myRetired;          // directories replaced by larger ones
+
+  ChunkedArray(const ChunkedArray &);
+  ChunkedArray &operator=(const ChunkedArray &);
+};
+
+
+template<class T, size_t ChunkLength>
+void ChunkedArray<T, ChunkLength>::push_back(const T &v)
+  // Appends v.  Writer only.
+{
+  T **directory = myDirectory.load(memory_order_relaxed);
+  size_t chunk = mySize / ChunkLength;
+
+  if(mySize % ChunkLength == 0){
+    if(chunk == myDirectoryLength){
+      // copy into a larger directory; readers may still use the old one
+      size_t length = myDirectoryLength ? 2 * myDirectoryLength : 16;
+      T **larger = new T *[length];
+      for(size_t c = 0; c < myDirectoryLength; c++)
+	larger[c] = directory[c];
+      if(directory)
+	myRetired.push_back(directory);
+      directory = larger;
+      myDirectoryLength = length;
+    }
+    directory[chunk] = new T[ChunkLength];
+    myDirectory.store(directory, memory_order_release);
+  }
+
+  directory[chunk][mySize % ChunkLength] = v;
+  mySize++;
+}
+
+template<class T, size_t ChunkLength>
+void ChunkedArray<T, ChunkLength>::clear()
+  // Removes every element.  Writer only, with no readers left.
+{
+  T **directory = myDirectory.load(memory_order_relaxed);
+  for(size_t c = 0; c < (mySize + ChunkLength - 1) / ChunkLength; c++)
+    delete [] directory[c];
+  delete [] directory;
+  for(T **old : myRetired)
+    delete [] old;
+  myRetired.clear();
+  myDirectory.store(NULL, memory_order_relaxed);
+  myDirectoryLength = 0;
+  mySize = 0;
+}
+
+#endif
@@ -0,0 +1,118 @@
+#include "ColumnExport.h"
+#include "ReportWriter.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+#include <algorithm>
+
+ColumnExport::ColumnExport()
+  // Creates an export with no instructions
+{
+}
+
+void ColumnExport::addInstruction(const Instruction &i)
+  // Adds the next instruction
+{
+  myOpcodes.push_back(i.getOpcode());
+  myRS.push_back(i.getRS());
+  myRT.push_back(i.getRT());
+  myRD.push_back(i.getRD());
+  myImmediates.push_back(i.getImmediate());
+}
+
+bool ColumnExport::write(const string &filename, const DependencyChecker &checker) const
+  // Writes the instructions added and the dependences found by checker to
+  // filename.  Returns false if the file cannot be written.
+{
+  // the dependence columns are decoded from the checker's compact store
+  size_t numDeps = checker.numDependences();
+  vector<uint8_t> types, registers;
+  vector<int32_t> producers, consumers;
+  types.reserve(numDeps);
+  registers.reserve(numDeps);
+  producers.reserve(numDeps);
+  consumers.reserve(numDeps);
+  checker.forEachDependence([&](const Dependence &d){
+      types.push_back(d.dependenceType);
+      registers.push_back(d.registerNumber);
+      producers.push_back(d.previousInstructionNumber);
+      consumers.push_back(d.currentInstructionNumber);
+    });
+
+  struct Column {
+    const char *name;
+    const void *data;
+    uint32_t elementSize;
+    uint32_t isSigned;
+    size_t count;
+  };
+  const Column columns[] = {
+    { "instruction.opcode", myOpcodes.data(), 1, 0, myOpcodes.size() },
+    { "instruction.rs", myRS.data(), 1, 0, myRS.size() },
+    { "instruction.rt", myRT.data(), 1, 0, myRT.size() },
+    { "instruction.rd", myRD.data(), 1, 0, myRD.size() },
+    { "instruction.imm", myImmediates.data(), 4, 1, myImmediates.size() },
+    { "dependence.type", types.data(), 1, 0, types.size() },
+    { "dependence.register", registers.data(), 1, 0, registers.size() },
+    { "dependence.producer", producers.data(), 4, 1, producers.size() },
+    { "dependence.consumer", consumers.data(), 4, 1, consumers.size() }
+  };
+  const int numColumns = sizeof(columns) / sizeof(columns[0]);
+
+  ColumnFileHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, "DCHKCOL", 8);
+  header.version = 1;
+  header.byteOrderMark = 0x01020304;
+  header.numInstructions = myOpcodes.size();
+  header.numDependences = numDeps;
+  header.numColumns = numColumns;
+  header.descriptorSize = sizeof(ColumnDescriptor);
+
+  // lay the columns out after the descriptors, each aligned
+  ColumnDescriptor descriptors[numColumns];
+  memset(descriptors, 0, sizeof(descriptors));
+  uint64_t offset = sizeof(header) + sizeof(descriptors);
+  for(int c = 0; c < numColumns; c++){
+    offset = (offset + ColumnAlignment - 1) / ColumnAlignment * ColumnAlignment;
+    strncpy(descriptors[c].name, columns[c].name, sizeof(descriptors[c].name) - 1);
+    descriptors[c].elementSize = columns[c].elementSize;
+    descriptors[c].isSigned = columns[c].isSigned;
+    descriptors[c].offset = offset;
+    descriptors[c].length = (uint64_t)columns[c].elementSize * columns[c].count;
+    offset += descriptors[c].length;
+  }
+
+  // header, descriptors, then each column behind its padding
+  static const char padding[ColumnAlignment] = { 0 };
+  vector<struct iovec> iov;
+  struct iovec v;
+  v.iov_base = &header;
+  v.iov_len = sizeof(header);
+  iov.push_back(v);
+  v.iov_base = descriptors;
+  v.iov_len = sizeof(descriptors);
+  iov.push_back(v);
+  uint64_t end = sizeof(header) + sizeof(descriptors);
+  for(int c = 0; c < numColumns; c++){
+    if(descriptors[c].offset > end){
+      v.iov_base = (void *)padding;
+      v.iov_len = descriptors[c].offset - end;
+      iov.push_back(v);
+    }
+    if(descriptors[c].length > 0){
+      v.iov_base = (void *)columns[c].data;
+      v.iov_len = descriptors[c].length;
+      iov.push_back(v);
+    }
+    end = descriptors[c].offset + descriptors[c].length;
+  }
+
+  int fd = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if(fd < 0)
+    return false;
+  bool ok = ReportWriter::writeAll(fd, iov);
+  if(close(fd) != 0)
+    ok = false;
+  return ok;
+}
@@ -0,0 +1,69 @@
+#ifndef __COLUMNEXPORT_H__
+#define __COLUMNEXPORT_H__
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+using namespace std;
+
+#include "Instruction.h"
+#include "DependencyChecker.h"
+
+/* Writes the instructions and dependences of a run to a columnar file that
+ * other tools can mmap and scan a column at a time without parsing text.
+ * All values are in the byte order of the machine that wrote the file
+ * (see byteOrderMark).  The file is
+ *
+ *   ColumnFileHeader
+ *   ColumnDescriptor[numColumns]
+ *   the columns, each a packed array starting at a multiple of
+ *   ColumnAlignment bytes
+ *
+ * Instruction columns have one element per instruction (instruction k is
+ * element k) and dependence columns one per dependence, in report order.
+ * Registers that an instruction does not use are stored as 32.
+ */
+
+// Start of the file
+struct ColumnFileHeader {
+  char magic[8];              // "DCHKCOL\0"
+  uint32_t version;           // 1
+  uint32_t byteOrderMark;     // 0x01020304 as written by the producer
+  uint64_t numInstructions;
+  uint64_t numDependences;
+  uint32_t numColumns;
+  uint32_t descriptorSize;    // sizeof(ColumnDescriptor)
+};
+
+// Where one column is
+struct ColumnDescriptor {
+  char name[24];              // e.g. "instruction.opcode", NUL padded
+  uint32_t elementSize;       // bytes per element
+  uint32_t isSigned;          // 1 for signed integers
+  uint64_t offset;            // from the start of the file
+  uint64_t length;            // in bytes
+};
+
+class ColumnExport {
+ public:
+  // Columns start at multiples of this many bytes
+  static const size_t ColumnAlignment = 64;
+
+  // Creates an export with no instructions
+  ColumnExport();
+
+  // Adds the next instruction
+  void addInstruction(const Instruction &i);
+
+  // Writes the instructions added and the dependences found by checker to
+  // filename.  Returns false if the file cannot be written.
+  bool write(const string &filename, const DependencyChecker &checker) const;
+
+ private:
+  vector<uint8_t> myOpcodes;
+  vector<uint8_t> myRS, myRT, myRD;
+  vector<int32_t> myImmediates;
+};
+
+#endif
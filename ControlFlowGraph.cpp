@@ -0,0 +1,238 @@
+#include "ControlFlowGraph.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <deque>
+
+ControlFlowGraph::ControlFlowGraph()
+  // Creates an empty program
+{
+}
+
+void ControlFlowGraph::addInstruction(const Instruction &i, const vector<int> &labels)
+  // Adds the next instruction; labels are the addresses of the labels
+  // defined at it (see ASMParser::getLabels)
+{
+  Operation o;
+  o.opcode = i.getOpcode();
+  o.rs = i.getRS();
+  o.rt = i.getRT();
+  o.rd = i.getRD();
+  o.target = i.getImmediate();
+
+  for(int label : labels)
+    myLabels[label] = myOperations.size();
+  myOperations.push_back(o);
+}
+
+template<class F>
+void ControlFlowGraph::forEachAccess(const Operation &o, F f)
+  // Calls f(reg, type) for every register access of o, in the order
+  // DependencyChecker checks them (reads before the write)
+{
+  if(o.opcode < 0 || o.opcode >= UNDEFINED)
+    return;
+  if(readsRS(o.opcode) && o.rs < NumRegisters)
+    f(o.rs, READ);
+  if(readsRT(o.opcode) && o.rt < NumRegisters)
+    f(o.rt, READ);
+  if(writesRD(o.opcode) && o.rd < NumRegisters)
+    f(o.rd, WRITE);
+  if(writesRT(o.opcode) && o.rt < NumRegisters)
+    f(o.rt, WRITE);
+}
+
+void ControlFlowGraph::analyze(int numThreads)
+  // Builds the blocks and finds the dependences using numThreads threads
+  // (0: one per hardware thread)
+{
+  ThreadPool pool(numThreads);
+
+  buildBlocks();
+
+  myExits.assign(myBlocks.size(), vector<Access>());
+  myTouched.assign(myBlocks.size(), 0);
+  pool.parallelFor(myBlocks.size(), [this](size_t b){ summarize(b); });
+
+  propagate();
+
+  vector<vector<Dependence> > found(myBlocks.size());
+  pool.parallelFor(myBlocks.size(), [this, &found](size_t b){ replay(b, found[b]); });
+
+  // the blocks are in instruction order, so their lists join in order
+  myDependences.clear();
+  for(vector<Dependence> &deps : found){
+    for(const Dependence &d : deps)
+      myDependences.append(d);
+    vector<Dependence>().swap(deps);
+  }
+}
+
+void ControlFlowGraph::buildBlocks()
+  // Splits the instructions into blocks and links them
+{
+  int n = myOperations.size();
+  vector<bool> leader(n + 1, false);
+  leader[0] = leader[n] = true;
+  for(map<int, int>::const_iterator it = myLabels.begin(); it != myLabels.end(); ++it)
+    leader[it->second] = true;
+  for(int k = 0; k < n; k++)
+    if(myOperations[k].opcode == J)
+      leader[k + 1] = true;
+
+  myBlocks.clear();
+  vector<int> blockOf(n, -1);
+  for(int k = 0; k < n; k++){
+    if(leader[k]){
+      BasicBlock b;
+      b.first = b.last = k;
+      b.successor = -1;
+      myBlocks.push_back(b);
+    }
+    myBlocks.back().last = k;
+    blockOf[k] = myBlocks.size() - 1;
+  }
+
+  for(size_t b = 0; b < myBlocks.size(); b++){
+    const Operation &end = myOperations[myBlocks[b].last];
+    if(end.opcode == J){
+      map<int, int>::const_iterator it = myLabels.find(end.target);
+      if(it != myLabels.end())
+	myBlocks[b].successor = blockOf[it->second];
+    }
+    else if(b + 1 < myBlocks.size())
+      myBlocks[b].successor = b + 1;
+
+    if(myBlocks[b].successor != -1)
+      myBlocks[myBlocks[b].successor].predecessors.push_back(b);
+  }
+}
+
+void ControlFlowGraph::summarize(size_t b)
+  // Fills in myExits and myTouched for block b
+{
+  Access last[NumRegisters];
+  uint64_t touched = 0;
+
+  for(int k = myBlocks[b].first; k <= myBlocks[b].last; k++){
+    forEachAccess(myOperations[k], [&](unsigned reg, AccessType type){
+	last[reg].reg = reg;
+	last[reg].instruction = k;
+	last[reg].type = type;
+	touched |= (uint64_t)1 << reg;
+      });
+  }
+
+  myTouched[b] = touched;
+  for(int r = 0; r < NumRegisters; r++)
+    if(touched & ((uint64_t)1 << r))
+      myExits[b].push_back(last[r]);
+}
+
+void ControlFlowGraph::propagate()
+  // Computes myEntries with a worklist over the blocks
+{
+  myEntries.assign(myBlocks.size(), vector<Access>());
+
+  // every block is visited once, so blocks nothing jumps to (including the
+  // first) still pass their accesses on; they start with empty entry sets
+  deque<int> work;
+  vector<bool> queued(myBlocks.size(), true);
+  for(size_t b = 0; b < myBlocks.size(); b++)
+    work.push_back(b);
+
+  vector<Access> out, merged;
+  while(!work.empty()){
+    int b = work.front();
+    work.pop_front();
+    queued[b] = false;
+
+    int s = myBlocks[b].successor;
+    if(s == -1)
+      continue;
+
+    // the accesses leaving b: its own last accesses and whatever reached it
+    // on registers it does not touch
+    out.clear();
+    for(const Access &a : myEntries[b])
+      if(!(myTouched[b] & ((uint64_t)1 << a.reg)))
+	out.push_back(a);
+    size_t passed = out.size();
+    out.insert(out.end(), myExits[b].begin(), myExits[b].end());
+    inplace_merge(out.begin(), out.begin() + passed, out.end());
+
+    merged.clear();
+    set_union(myEntries[s].begin(), myEntries[s].end(), out.begin(), out.end(),
+	      back_inserter(merged));
+    if(merged.size() != myEntries[s].size()){
+      myEntries[s].swap(merged);
+      if(!queued[s]){
+	queued[s] = true;
+	work.push_back(s);
+      }
+    }
+  }
+}
+
+void ControlFlowGraph::replay(size_t b, vector<Dependence> &out) const
+  // Appends the dependences of block b to out, in order
+{
+  // accesses within the block; A_UNDEFINED means look at the entry set
+  Access last[NumRegisters];
+  for(int r = 0; r < NumRegisters; r++)
+    last[r].type = A_UNDEFINED;
+
+  // where the entry accesses of each register start in myEntries[b]
+  const vector<Access> &entry = myEntries[b];
+  size_t start[NumRegisters + 1];
+  size_t e = 0;
+  for(int r = 0; r <= NumRegisters; r++){
+    while(e < entry.size() && entry[e].reg < (unsigned)r)
+      e++;
+    start[r] = e;
+  }
+
+  for(int k = myBlocks[b].first; k <= myBlocks[b].last; k++){
+    forEachAccess(myOperations[k], [&](unsigned reg, AccessType type){
+	auto depend = [&](const Access &a){
+	  Dependence d;
+	  if(type == READ && a.type == WRITE)
+	    d.dependenceType = RAW;
+	  else if(type == WRITE && a.type == WRITE)
+	    d.dependenceType = WAW;
+	  else if(type == WRITE && a.type == READ)
+	    d.dependenceType = WAR;
+	  else
+	    return;
+	  d.registerNumber = reg;
+	  d.previousInstructionNumber = a.instruction;
+	  d.currentInstructionNumber = k;
+	  out.push_back(d);
+	};
+
+	if(last[reg].type != A_UNDEFINED)
+	  depend(last[reg]);
+	else
+	  for(size_t a = start[reg]; a < start[reg + 1]; a++)
+	    depend(entry[a]);
+
+	last[reg].reg = reg;
+	last[reg].instruction = k;
+	last[reg].type = type;
+      });
+  }
+}
+
+void ControlFlowGraph::printSummary(ostream &out) const
+  // Prints the number of blocks, edges and join points
+{
+  size_t edges = 0, joins = 0;
+  for(const BasicBlock &b : myBlocks){
+    if(b.successor != -1)
+      edges++;
+    if(b.predecessors.size() > 1)
+      joins++;
+  }
+  out << "BASIC BLOCKS: " << myBlocks.size() << endl
+      << "EDGES: " << edges << endl
+      << "JOIN POINTS: " << joins << endl;
+}
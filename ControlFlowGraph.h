@@ -0,0 +1,122 @@
+#ifndef __CONTROLFLOWGRAPH_H__
+#define __CONTROLFLOWGRAPH_H__
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <stdint.h>
+
+using namespace std;
+
+#include "Instruction.h"
+#include "OpcodeTable.h"
+#include "RegisterTable.h"
+#include "Dependence.h"
+#include "DependenceStore.h"
+#include "DependencyChecker.h"
+
+// A straight run of instructions [first, last] entered only at first
+struct BasicBlock {
+  int first;
+  int last;
+  int successor;               // block executed after it, or -1 at the exit
+  vector<int> predecessors;
+};
+
+/* This class finds the data dependences of a program along its control flow
+ * instead of as one straight line.  The program is split into basic blocks
+ * at every j and at every instruction a label is defined at; a block ending
+ * in j is followed by the block of its target (none if the label is not
+ * defined) and any other block falls through to the next one.
+ *
+ * The analysis runs in three passes:
+ *   1. every block is summarized on its own, in parallel: the last access
+ *      to each register it touches;
+ *   2. a worklist pass propagates, for every block and register, the set
+ *      of accesses that may reach the start of the block, merging the sets
+ *      at join points until nothing changes;
+ *   3. every block is replayed from its entry sets, in parallel, giving its
+ *      dependences.
+ * An access reached by several earlier accesses gets one dependence on each
+ * of them.  Dependences are kept in ascending order of the second
+ * instruction, as DependencyChecker keeps them.
+ */
+class ControlFlowGraph {
+ public:
+  // Creates an empty program
+  ControlFlowGraph();
+
+  // Adds the next instruction; labels are the addresses of the labels
+  // defined at it (see ASMParser::getLabels)
+  void addInstruction(const Instruction &i, const vector<int> &labels);
+
+  // Builds the blocks and finds the dependences using numThreads threads
+  // (0: one per hardware thread)
+  void analyze(int numThreads = 0);
+
+  // Returns the number of basic blocks (after analyze)
+  size_t numBlocks() const { return myBlocks.size(); };
+
+  // Returns basic block b (after analyze)
+  const BasicBlock &getBlock(size_t b) const { return myBlocks[b]; };
+
+  // Returns the dependences found by analyze
+  const DependenceStore &getDependences() const { return myDependences; };
+
+  // Prints the number of blocks, edges and join points
+  void printSummary(ostream &out) const;
+
+ private:
+  // The register fields of an instruction
+  struct Operation {
+    Opcode opcode;
+    uint8_t rs, rt, rd;
+    int target;                // immediate of a j
+  };
+
+  // One access to a register
+  struct Access {
+    unsigned reg;
+    int instruction;
+    AccessType type;
+
+    bool operator<(const Access &a) const {
+      if(reg != a.reg)
+	return reg < a.reg;
+      if(instruction != a.instruction)
+	return instruction < a.instruction;
+      return type < a.type;
+    };
+    bool operator==(const Access &a) const {
+      return reg == a.reg && instruction == a.instruction && type == a.type;
+    };
+  };
+
+  vector<Operation> myOperations;
+  map<int, int> myLabels;             // label address -> instruction
+
+  vector<BasicBlock> myBlocks;
+  vector<vector<Access> > myExits;    // last access to each register a block touches
+  vector<uint64_t> myTouched;         // registers each block accesses
+  vector<vector<Access> > myEntries;  // accesses that may reach each block, sorted
+  DependenceStore myDependences;
+
+  // Splits the instructions into blocks and links them
+  void buildBlocks();
+
+  // Fills in myExits and myTouched for block b
+  void summarize(size_t b);
+
+  // Computes myEntries with a worklist over the blocks
+  void propagate();
+
+  // Appends the dependences of block b to out, in order
+  void replay(size_t b, vector<Dependence> &out) const;
+
+  // Calls f(reg, type) for every register access of o, in the order
+  // DependencyChecker checks them (reads before the write)
+  template<class F>
+  static void forEachAccess(const Operation &o, F f);
+};
+
+#endif
@@ -0,0 +1,149 @@
+#include "CriticalPath.h"
+#include <sstream>
+#include <stdlib.h>
+#include <errno.h>
+#include <climits>
+
+LatencyTable::LatencyTable()
+  // Sets every latency to 1
+{
+  for(int o = 0; o <= (int)UNDEFINED; o++)
+    myLatency[o] = 1;
+}
+
+bool LatencyTable::parse(const string &spec)
+  // Parses a list like "mult=4,lb=2" and sets the named latencies.  Returns
+  // false if the list is malformed or names an unknown mnemonic.
+{
+  OpcodeTable opcodes;
+  stringstream in(spec);
+  string item;
+
+  while(getline(in, item, ',')){
+    string::size_type eq = item.find('=');
+    if(eq == string::npos)
+      return false;
+    Opcode o = opcodes.getOpcode(item.substr(0, eq));
+    const char *number = item.c_str() + eq + 1;
+    char *end;
+    errno = 0;
+    long cycles = strtol(number, &end, 10);
+    if(o == UNDEFINED || end == number || *end != '\0' || errno != 0 ||
+       cycles < 1 || cycles > INT_MAX)
+      return false;
+    myLatency[o] = cycles;
+  }
+  return true;
+}
+
+
+CriticalPath::CriticalPath(const LatencyTable &latencies)
+  // Creates an empty analysis using the given latencies
+  : myLatencies(latencies)
+{
+  for(int r = 0; r < NumRegisters; r++)
+    myLastWriter[r] = -1;
+  myLastLOWriter = -1;
+  myLength = 0;
+  myLast = -1;
+}
+
+void CriticalPath::readRegister(Register reg, long &start, int &pred)
+  // Moves the start of the current instruction past the finish of the last
+  // writer of reg
+{
+  if(reg < 0 || reg >= NumRegisters)
+    return;
+  waitFor(myLastWriter[reg], start, pred);
+}
+
+void CriticalPath::waitFor(int w, long &start, int &pred)
+  // Moves the start of the current instruction past the finish of
+  // instruction w (none if -1)
+{
+  if(w != -1 && myFinish[w] > start){
+    start = myFinish[w];
+    pred = w;
+  }
+}
+
+void CriticalPath::addInstruction(const Instruction &i)
+  // Adds the next instruction of the sequence
+{
+  Opcode o = i.getOpcode();
+  int n = myFinish.size();
+  long start = 0;
+  int pred = -1;
+
+  if(o != UNDEFINED){
+    if(readsRS(o))
+      readRegister(i.getRS(), start, pred);
+    if(readsRT(o))
+      readRegister(i.getRT(), start, pred);
+    if(readsLO(o))
+      waitFor(myLastLOWriter, start, pred);
+  }
+
+  long finish = start + myLatencies.get(o);
+  myFinish.push_back(finish);
+  myPredecessor.push_back(pred);
+  if(finish > myLength){
+    myLength = finish;
+    myLast = n;
+  }
+
+  if(o != UNDEFINED){
+    if(writesRD(o) && i.getRD() < NumRegisters)
+      myLastWriter[i.getRD()] = n;
+    if(writesRT(o) && i.getRT() < NumRegisters)
+      myLastWriter[i.getRT()] = n;
+    if(writesLO(o))
+      myLastLOWriter = n;
+  }
+}
+
+
+vector<int> CriticalPath::chain() const
+  // Returns the instruction numbers on the critical path, first to last
+{
+  vector<int> c;
+  for(int k = myLast; k != -1; k = myPredecessor[k])
+    c.push_back(k);
+  return vector<int>(c.rbegin(), c.rend());
+}
+
+double CriticalPath::ilp() const
+  // Returns instructions / critical path length
+{
+  if(myLength == 0)
+    return 0;
+  return (double)myFinish.size() / myLength;
+}
+
+int CriticalPath::issueWidth() const
+  // Returns the issue width needed to execute the sequence in critical path
+  // time if there were no other limits
+{
+  if(myLength == 0)
+    return 0;
+  return (myFinish.size() + myLength - 1) / myLength;
+}
+
+void CriticalPath::print(ostream &out) const
+  // Prints length, ILP, issue width and the chain
+{
+  vector<int> c = chain();
+
+  out << "CRITICAL PATH:" << endl;
+  out << "Instructions: " << myFinish.size() << endl;
+  out << "Length (cycles): " << myLength << endl;
+  out << "Chain length (instructions): " << c.size() << endl;
+  out.setf(ios::fixed);
+  out.precision(2);
+  out << "ILP: " << ilp() << endl;
+  out << "Ideal issue width: " << issueWidth() << endl;
+  out << "Chain:";
+  for(size_t k = 0; k < c.size(); k++)
+    out << (k == 0 ? " " : " -> ") << c[k];
+  out << endl;
+}
@@ -0,0 +1,90 @@
+#ifndef __CRITICALPATH_H__
+#define __CRITICALPATH_H__
+
+#include <iostream>
+#include <vector>
+#include <string>
+
+using namespace std;
+
+#include "Instruction.h"
+#include "OpcodeTable.h"
+#include "RegisterTable.h"
+
+/* Latency in cycles of every Opcode: the number of cycles after an
+ * instruction issues before an instruction that reads its result can issue.
+ * Every opcode defaults to 1.
+ */
+class LatencyTable {
+ public:
+  // Sets every latency to 1
+  LatencyTable();
+
+  // Returns the latency of o
+  int get(Opcode o) const { return myLatency[o]; };
+
+  // Sets the latency of o
+  void set(Opcode o, int cycles) { myLatency[o] = cycles; };
+
+  // Parses a list like "mult=4,lb=2" and sets the named latencies.  Returns
+  // false if the list is malformed or names an unknown mnemonic.
+  bool parse(const string &spec);
+
+ private:
+  int myLatency[UNDEFINED + 1];
+};
+
+
+/* This class finds the longest chain of true (read after write) dependences
+ * in a sequence of instructions.  Instructions are processed in order in a
+ * single pass: each instruction can start once every instruction that wrote
+ * one of its source registers (or, for mflo, LO: the last mult) has finished, which is a dynamic program over
+ * the dependence DAG in topological order.  The length of the chain is a lower
+ * bound on execution time, and instructions / length is the available ILP.
+ */
+class CriticalPath {
+ public:
+  // Creates an empty analysis using the given latencies
+  CriticalPath(const LatencyTable &latencies);
+
+  // Adds the next instruction of the sequence
+  void addInstruction(const Instruction &i);
+
+  // Returns the number of instructions added
+  int numInstructions() const { return myFinish.size(); };
+
+  // Returns the length of the critical path in cycles
+  long length() const { return myLength; };
+
+  // Returns the instruction numbers on the critical path, first to last
+  vector<int> chain() const;
+
+  // Returns instructions / critical path length
+  double ilp() const;
+
+  // Returns the issue width needed to execute the sequence in critical path
+  // time if there were no other limits
+  int issueWidth() const;
+
+  // Prints length, ILP, issue width and the chain
+  void print(ostream &out) const;
+
+ private:
+  const LatencyTable &myLatencies;
+  int myLastWriter[NumRegisters];   // last instruction to write each register
+  int myLastLOWriter;               // last mult, which writes LO
+  vector<long> myFinish;            // cycle at which each instruction finishes
+  vector<int> myPredecessor;        // producer that determined the start, or -1
+  long myLength;
+  int myLast;                       // instruction finishing last
+
+  // Moves the start of the current instruction past the finish of the last
+  // writer of reg
+  void readRegister(Register reg, long &start, int &pred);
+
+  // Moves the start of the current instruction past the finish of
+  // instruction w (none if -1)
+  void waitFor(int w, long &start, int &pred);
+};
+
+#endif
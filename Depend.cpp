@@ -1,36 +1,861 @@
 #include "ASMParser.h"
+#include "BinaryParser.h"
 #include "DependencyChecker.h"
+#include "DependenceIndex.h"
+#include "CriticalPath.h"
+#include "Scheduler.h"
+#include "Renamer.h"
+#include "ControlFlowGraph.h"
+#include "ColumnExport.h"
+#include "Sampler.h"
+#include "PerfCounters.h"
+#include "ReportWriter.h"
+#include "SPSCQueue.h"
+#include "Checkpoint.h"
+#include "ExternalReport.h"
+#include "DependenceDiff.h"
 #include <iostream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
 #include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <climits>
+#include <cmath>
+#include <type_traits>
 
 using namespace std;
 
-int main(int argc, char *argv[])
+// Prints the command line options and exits
+static void usage()
 {
-  DependencyChecker checker;
-  ASMParser *parser;
+  cerr << "usage: DCHECKER [options] file" << endl
+       << "       DCHECKER [options] --diff old new" << endl
+       << "  file may be - for standard input and may be gzip or zstd compressed" << endl
+       << "  --binary          file is a flat image of 32 bit MIPS words" << endl
+       << "  --big-endian      binary words are big endian (default little endian)" << endl
+       << "  --elf             take the words from the .text section of an ELF file" << endl
+       << "  --offset N        skip N bytes of the image (or of .text)" << endl
+       << "  --jobs N          threads used to format the report (default: all)" << endl
+       << "  --tail N          keep the text of only the last N instructions; the" << endl
+       << "                    report lists just those (dependences are all listed)" << endl
+       << "  --serial          parse, check and print one after another on one thread" << endl
+       << "                    instead of as a pipeline (the default with one processor)" << endl
+       << "  --pipeline        run as a pipeline even with one processor" << endl
+       << "  --progress        report progress to stderr every second (implies --serial)" << endl
+       << "  --perf-counters   print hardware counters (or CPU time) of each phase of" << endl
+       << "                    DCHECKER itself to stderr" << endl
+       << "  --export FILE     write the instructions and dependences to FILE as packed" << endl
+       << "                    columns (see ColumnExport.h) instead of printing them" << endl
+       << "  --checkpoint FILE save the state of the report to FILE (and FILE.text," << endl
+       << "                    FILE.deps) as it runs, so it can be resumed" << endl
+       << "  --checkpoint-every N  instructions between checkpoints (default 1000000)" << endl
+       << "  --resume          continue from the checkpoint in FILE, if there is one" << endl
+       << "  --memory-budget SIZE  keep at most about SIZE bytes (e.g. 512M, 2G) of" << endl
+       << "                    the report in memory; the rest is spilled to files in" << endl
+       << "                    $TMPDIR (default /tmp) and read back to print it" << endl
+       << "query options (print only the matching dependences):" << endl
+       << "  --depends-on K    dependences of instruction K on earlier ones" << endl
+       << "  --dependents K    dependences of later instructions on instruction K" << endl
+       << "  --register REG    only dependences on REG (e.g. $t3)" << endl
+       << "  --type T          only dependences of type T (RAW, WAR or WAW)" << endl
+       << "  --from N --to M   only dependences whose second instruction is in [N, M]" << endl
+       << "analyses (print a summary instead of the dependence report):" << endl
+       << "  --stats           dependence counts, distance histograms and per opcode" << endl
+       << "                    hazard rates, without storing the dependences" << endl
+       << "  --stats-json      the same statistics as JSON" << endl
+       << "  --sample RATE     estimate the statistics of --stats, with confidence" << endl
+       << "                    intervals, from about RATE (e.g. 0.01) of the input" << endl
+       << "  --window N        instructions per sampled window (default 10000)" << endl
+       << "  --warmup N        instructions checked before each window (default 1000)" << endl
+       << "  --seed N          selects the sampled windows (default 1)" << endl
+       << "  --critical-path   longest true dependence chain, ILP and issue width" << endl
+       << "  --latency LIST    per opcode latencies, e.g. mult=4,lb=2 (default 1)" << endl
+       << "  --cfg             follow control flow: split the program into basic blocks" << endl
+       << "                    at j and labels and report the dependences along the" << endl
+       << "                    paths between them (block counts go to stderr)" << endl
+       << "  --diff            align the instructions of two versions of a program and" << endl
+       << "                    print the dependences removed (-) and added (+)" << endl
+       << "transformations (print rewritten assembly; statistics go to stderr):" << endl
+       << "  --schedule        reorder each region between jumps to reduce stalls" << endl
+       << "  --rename          rename registers to remove WAR and WAW dependences" << endl
+       << "  --pool N          physical registers available to --rename (default 64)" << endl;
+  exit(1);
+}
 
-  if(argc != 2){
-    cerr << "Need to enter input file name" << endl;
+// Where the instructions come from
+struct InputOptions {
+  const char *filename;
+  bool binary;
+  bool elf;
+  ByteOrder order;
+  long offset;
+  bool text;            // the instructions' assembly text is printed
+};
+
+// What DCHECKER prints
+enum Mode {
+  REPORT,
+  QUERY,
+  EXPORT,
+  STATS,
+  STATS_JSON,
+  SAMPLE,
+  CRITICAL_PATH,
+  CONTROL_FLOW,
+  DIFF,
+  SCHEDULE,
+  RENAME
+};
+
+// Lookups requested on the command line
+struct Query {
+  bool active;
+  int from, to;            // range of second instructions
+  int producer;            // first instruction for --dependents, or -1
+  DependenceType type;
+  int reg;
+};
+
+// Answers q from an index over the checker's results
+static void runQuery(DependencyChecker &checker, Query &q)
+{
+  DependenceIndex index(checker);
+  DependenceRange r;
+
+  if(q.producer != -1)
+    r = index.dependents(q.producer, q.producer);
+  else
+    r = index.find(q.from, q.to, q.type, q.reg);
+
+  cout << "DEPENDENCES: \nType Register (FirstInstr#, SecondInstr#) " << endl;
+  for(const Dependence &d : r){
+    // --dependents is answered by producer; apply the other filters here
+    if(q.producer != -1 &&
+       ((q.type != D_UNDEFINED && d.dependenceType != q.type) ||
+	(q.reg != -1 && (int)d.registerNumber != q.reg) ||
+	d.currentInstructionNumber < q.from || d.currentInstructionNumber > q.to))
+      continue;
+    DependencyChecker::printDependence(cout, d);
+  }
+}
+
+// Instructions parsed (by every parser opened), for --perf-counters
+static uint64_t instructionsRead = 0;
+
+// Calls f(i) for every Instruction i from parser, or f(i, labels) if f
+// also wants the labels defined at i
+template<class Parser, class F>
+static void forEachInstruction(Parser &parser, F f)
+{
+  Instruction i;
+
+  i = parser.getNextInstruction();
+  while( i.getOpcode() != UNDEFINED){
+    if constexpr (is_invocable<F, Instruction &>::value)
+      f(i);
+    else
+      f(i, parser.getLabels());
+    i = parser.getNextInstruction();
+  }
+}
+
+/* Prints to stderr, every second until it is destroyed, how far a
+ * DependencyChecker has got.  It runs on its own thread and reads the
+ * checker only through its published counts and snapshots, so the checker
+ * is never locked or slowed down.
+ */
+class ProgressMonitor {
+ public:
+  ProgressMonitor(const DependencyChecker &checker)
+    : myChecker(checker), myStop(false), myThread(&ProgressMonitor::run, this) {};
+
+  ~ProgressMonitor() {
+    {
+      lock_guard<mutex> lock(myLock);
+      myStop = true;
+    }
+    myWake.notify_one();
+    myThread.join();
+  };
+
+ private:
+  const DependencyChecker &myChecker;
+  mutex myLock;                   // only for stopping the monitor
+  condition_variable myWake;
+  bool myStop;
+  thread myThread;
+
+  void run() {
+    size_t seen = 0;
+    uint64_t counts[D_UNDEFINED] = { 0, 0, 0 };
+    unique_lock<mutex> lock(myLock);
+    while(!myWake.wait_for(lock, chrono::seconds(1), [this]{ return myStop; })){
+      int instructions = myChecker.numInstructions();
+      DependenceStore::Snapshot snapshot = myChecker.dependenceSnapshot();
+      // count only what was added since the last report
+      snapshot.forEach(seen, snapshot.size(), [&counts](const Dependence &d){
+	  counts[d.dependenceType]++;
+	});
+      seen = snapshot.size();
+      cerr << "PROGRESS: " << instructions << " instructions, " << seen
+	   << " dependences (RAW " << counts[RAW] << ", WAR " << counts[WAR]
+	   << ", WAW " << counts[WAW] << ")" << endl;
+    }
+  };
+};
+
+// Opens the parser for the input and calls f(parser).  Returns false if
+// the input cannot be read or is malformed.
+template<class F>
+static bool withParser(InputOptions &in, F f)
+{
+  if(in.binary){
+    BinaryParser parser(in.filename, in.order, in.elf, in.offset);
+    if(parser.isFormatCorrect() == false)
+      return false;
+    parser.setDisassembly(in.text);
+    f(parser);
+    instructionsRead += parser.numReturned();
+  }
+  else{
+    // the file is parsed as it is read, so errors can show up at any line
+    ASMParser parser(in.filename);
+    f(parser);
+    instructionsRead += parser.numReturned();
+    if(parser.isFormatCorrect() == false)
+      return false;
+  }
+  return true;
+}
+
+// Calls f(i) for every Instruction i of the input.  Returns false if the
+// input cannot be read or is malformed.
+template<class F>
+static bool parseInput(InputOptions &in, F f)
+{
+  return withParser(in, [&f](auto &parser){ forEachInstruction(parser, f); });
+}
+
+// Calls f(i) for every Instruction i of the input.  Exits with an error
+// message if the input cannot be read or is malformed.
+template<class F>
+static void readInput(InputOptions &in, F f)
+{
+  if(!parseInput(in, f)){
+    cerr << "Format of input file is incorrect " << endl;
     exit(1);
   }
+}
 
-  parser = new ASMParser(argv[1]);
+// Returns the names of the labels defined at the instruction parser last
+// returned.  An image has no names, so its jump targets are named the way
+// a j to them is disassembled.
+static vector<string> labelNames(ASMParser &parser)
+{
+  return parser.getLabelNames();
+}
 
-  if(parser->isFormatCorrect() == false){
+static vector<string> labelNames(BinaryParser &parser)
+{
+  vector<string> names;
+  for(int address : parser.getLabels()){
+    char name[16];
+    snprintf(name, sizeof(name), "0x%x", (unsigned)address);
+    names.push_back(name);
+  }
+  return names;
+}
+
+// Calls f(i, names) for every Instruction i of the input, with the names of
+// the labels defined at it.  Exits if the input cannot be read or is
+// malformed.
+template<class F>
+static void readNamedInput(InputOptions &in, F f)
+{
+  bool read = withParser(in, [&f](auto &parser){
+      forEachInstruction(parser, [&](Instruction &i){ f(i, labelNames(parser)); });
+    });
+  if(!read){
     cerr << "Format of input file is incorrect " << endl;
     exit(1);
   }
+}
 
-  Instruction i;
+// Work handed from one stage of the pipelined report to the next
+struct Batch {
+  vector<Instruction> instructions;
+  vector<Dependence> dependences;     // found in instructions, in order
+};
 
-  i = parser->getNextInstruction();
-  while( i.getOpcode() != UNDEFINED){
-    //    cout << i.getAssembly() << endl;
-    checker.addInstruction(i);
-    i = parser->getNextInstruction();
+// Puts the dependences found by a checker into the current batch
+class BatchCollector : public DependenceListener {
+ public:
+  vector<Dependence> *myDependences;
+
+  void dependenceFound(const Dependence &d, Opcode consumer)
+    { myDependences->push_back(d); };
+};
+
+static const size_t BatchSize = 4096;       // instructions per batch
+static const size_t QueueDepth = 16;        // batches between two stages
+static const size_t ChunkSize = 1 << 20;    // bytes of report text per write
+
+/* Prints the dependence report with parsing, checking and formatting running
+ * at the same time on three threads, connected by single-producer
+ * single-consumer queues of batches.  The dependences are listed after all
+ * the instructions, so they are kept in a DependenceStore until the input
+ * ends.  ASM input can turn out to be malformed at any line, so the
+ * formatted instruction text is held too (in chunks, about as much memory
+ * as the serial report keeps the instructions in) and nothing is written
+ * before the whole input has been parsed: malformed input prints no report,
+ * as in serial mode.  The output is the same as that of
+ * DependencyChecker::printDependences.
+ */
+static void runPipeline(InputOptions &input, int jobs)
+{
+  SPSCQueue<Batch> parsed(QueueDepth), checked(QueueDepth);
+  bool formatCorrect = true;
+
+  thread parseStage([&](){
+      Batch b;
+      b.instructions.reserve(BatchSize);
+      formatCorrect = parseInput(input, [&](Instruction &i){
+	  b.instructions.push_back(i);
+	  if(b.instructions.size() == BatchSize){
+	    parsed.push(move(b));
+	    b.instructions.clear();
+	    b.instructions.reserve(BatchSize);
+	  }
+	});
+      if(!b.instructions.empty())
+	parsed.push(move(b));
+      parsed.close();
+    });
+
+  thread checkStage([&](){
+      DependencyChecker checker;
+      BatchCollector collector;
+      checker.setListener(&collector, false);
+      Batch b;
+      while(parsed.pop(b)){
+	b.dependences.clear();
+	collector.myDependences = &b.dependences;
+	checker.addInstructions(b.instructions.data(), b.instructions.size());
+	checked.push(move(b));
+      }
+      checked.close();
+    });
+
+  // Format on this thread
+  cout.flush();
+  ReportWriter writer(1, jobs);
+  DependenceStore dependences;
+  vector<string> chunks;              // formatted text, ChunkSize at a time
+  string text = "INSTRUCTIONS:\n";
+  long k = 0;
+  Batch b;
+  while(checked.pop(b)){
+    PerfScope scope(PERF_OUTPUT);
+    for(const Instruction &i : b.instructions){
+      const string &assembly = i.getAssembly();
+      DependencyChecker::formatInstruction(text, k++, assembly.data(), assembly.size());
+    }
+    for(const Dependence &d : b.dependences)
+      dependences.append(d);
+    if(text.size() >= ChunkSize){
+      chunks.push_back(move(text));
+      text = string();
+    }
+  }
+  parseStage.join();
+  checkStage.join();
+
+  if(!formatCorrect){
+    cerr << "Format of input file is incorrect " << endl;
+    exit(1);
   }
-  checker.printDependences();
-  
-  delete parser;
+  PerfScope scope(PERF_OUTPUT);
+  for(string &chunk : chunks){
+    writer.write(chunk);
+    string().swap(chunk);
+  }
+  writer.write(text);
+
+  writer.write("DEPENDENCES: \nType Register (FirstInstr#, SecondInstr#) \n");
+  writer.writeRecords(dependences.size(), [&dependences](size_t first, size_t last, string &out){
+      dependences.forEach(first, last, [&out](const Dependence &d){
+	  DependencyChecker::formatDependence(out, d);
+	});
+    });
+  if(writer.hasError())
+    exit(1);
+}
+
+// Returns the number of bytes in s, a number with an optional K, M or G
+// suffix, or 0 if s is not one or is not a positive size that fits a size_t
+static size_t parseSize(const char *s)
+{
+  char *end;
+  double v = strtod(s, &end);
+  switch(*end){
+  case 'K': case 'k':
+    v *= 1 << 10;
+    end++;
+    break;
+  case 'M': case 'm':
+    v *= 1 << 20;
+    end++;
+    break;
+  case 'G': case 'g':
+    v *= 1 << 30;
+    end++;
+    break;
+  }
+  // (double)SIZE_MAX rounds up to 2^64, which is already too big; the
+  // comparisons also fail for nan
+  if(*end != '\0' || !isfinite(v) || !(v > 0 && v < (double)SIZE_MAX))
+    return 0;
+  return (size_t)v;
+}
+
+// Appends the report line of every dependence found to a string
+class DependenceFormatter : public DependenceListener {
+ public:
+  string *myOut;
+
+  void dependenceFound(const Dependence &d, Opcode consumer)
+    { DependencyChecker::formatDependence(*myOut, d); };
+};
+
+// Copies the label generator of parser into a checkpoint; binary input has
+// no label names
+static void saveLabels(ASMParser &parser, CheckpointState &state)
+{
+  parser.getLabelState(state.nextLabelAddress, state.labelAddresses, state.labelsDefined);
+}
+
+static void saveLabels(BinaryParser &parser, CheckpointState &state)
+{
+}
+
+// Returns the bytes of input parser has read; a binary image is read whole
+static uint64_t prefixBytes(ASMParser &parser)
+{
+  return parser.tell();
+}
+
+static uint64_t prefixBytes(BinaryParser &parser)
+{
+  return UINT64_MAX;
+}
+
+// Returns how in is parsed, for telling whether a checkpoint was taken of
+// the same input
+static string describeInput(const InputOptions &in)
+{
+  if(!in.binary)
+    return "asm";
+  return string("binary") + (in.elf ? " elf" : "") +
+    (in.order == BYTES_BIG_ENDIAN ? " big-endian" : " little-endian") +
+    " offset " + to_string(in.offset);
+}
+
+/* Prints the dependence report of checker's input, checkpointing to path
+ * every so many instructions (see Checkpointer).  The report lines go to
+ * the checkpoint's files as they are formatted and are printed from there
+ * at the end.  If resume is set and path holds a checkpoint, the input is
+ * read from where the checkpoint was taken, with the checker and label
+ * state it saved; the report is the same as that of an uninterrupted run.
+ */
+static void runCheckpointed(InputOptions &input, DependencyChecker &checker,
+			    const char *path, long every, bool resume)
+{
+  Checkpointer checkpoints(path, input.filename, describeInput(input));
+  CheckpointState state;
+  ResumeResult result = resume ? checkpoints.resume(state) : NO_CHECKPOINT;
+  if(result == OTHER_INPUT){
+    cerr << "The checkpoint in " << path << " is of another input or other options" << endl;
+    exit(1);
+  }
+  bool resumed = (result == RESUMED);
+  if(!resumed){
+    if(resume)
+      cerr << "No checkpoint in " << path << "; starting from the beginning" << endl;
+    state = CheckpointState();
+    if(!checkpoints.start()){
+      cerr << "Could not create " << path << ".text and " << path << ".deps" << endl;
+      exit(1);
+    }
+  }
+
+  string text, dependences;
+  DependenceFormatter formatter;
+  formatter.myOut = &dependences;
+  checker.setListener(&formatter, false);
+  if(resumed)
+    checker.restoreState(state.instructions, state.registers);
+
+  long k = state.instructions;
+  auto run = [&](auto &parser){
+    forEachInstruction(parser, [&](Instruction &i){
+	checker.addInstruction(i);
+	const string &assembly = i.getAssembly();
+	DependencyChecker::formatInstruction(text, k++, assembly.data(), assembly.size());
+	if(k % every != 0)
+	  return;
+	state.inputOffset = parser.tell();
+	state.prefixBytes = prefixBytes(parser);
+	state.instructions = k;
+	checker.saveState(state.registers);
+	saveLabels(parser, state);
+	state.textBytes += text.size();
+	state.dependenceBytes += dependences.size();
+	checkpoints.save(text, dependences, state);
+      });
+  };
+
+  bool formatCorrect;
+  if(input.binary){
+    BinaryParser parser(input.filename, input.order, input.elf, input.offset);
+    formatCorrect = parser.isFormatCorrect();
+    if(formatCorrect){
+      parser.skip(state.inputOffset);
+      run(parser);
+      instructionsRead += parser.numReturned();
+    }
+  }
+  else{
+    ASMParser parser(input.filename, state.inputOffset);
+    if(resumed)
+      parser.setLabelState(state.nextLabelAddress, state.labelAddresses, state.labelsDefined);
+    run(parser);
+    instructionsRead += parser.numReturned();
+    formatCorrect = parser.isFormatCorrect();
+  }
+  if(!formatCorrect){
+    cerr << "Format of input file is incorrect " << endl;
+    exit(1);
+  }
+
+  checkpoints.save(text, dependences, state);
+  cout.flush();
+  PerfScope scope(PERF_OUTPUT);
+  if(!checkpoints.finish(1)){
+    cerr << "Could not write the report from " << path << endl;
+    exit(1);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  InputOptions input = { NULL, false, false, BYTES_LITTLE_ENDIAN, 0, true };
+  Mode mode = REPORT;
+  LatencyTable latencies;
+  int poolSize = 2 * NumRegisters;
+  int jobs = 0;
+  long tail = 0;
+  bool serial = false;
+  bool pipeline = false;
+  bool progress = false;
+  const char *exportFile = NULL;
+  const char *checkpointFile = NULL;
+  long checkpointEvery = 1000000;
+  bool resume = false;
+  size_t memoryBudget = 0;
+  const char *newFile = NULL;      // second version for --diff
+  double sampleRate = 0;
+  long sampleWindow = 10000;
+  long warmup = 1000;
+  unsigned seed = 1;
+  Query query = { false, 0, INT_MAX, -1, D_UNDEFINED, -1 };
+  RegisterTable registers;
+
+  for(int a = 1; a < argc; a++){
+    if(strcmp(argv[a], "--binary") == 0)
+      input.binary = true;
+    else if(strcmp(argv[a], "--big-endian") == 0)
+      input.order = BYTES_BIG_ENDIAN;
+    else if(strcmp(argv[a], "--little-endian") == 0)
+      input.order = BYTES_LITTLE_ENDIAN;
+    else if(strcmp(argv[a], "--elf") == 0)
+      input.binary = input.elf = true;
+    else if(strcmp(argv[a], "--offset") == 0 && a + 1 < argc){
+      char *end;
+      errno = 0;
+      input.offset = strtol(argv[++a], &end, 0);
+      if(errno != 0 || end == argv[a] || *end != '\0' || input.offset < 0)
+	usage();
+    }
+    else if(strcmp(argv[a], "--jobs") == 0 && a + 1 < argc)
+      jobs = atoi(argv[++a]);
+    else if(strcmp(argv[a], "--tail") == 0 && a + 1 < argc){
+      tail = atol(argv[++a]);
+      if(tail <= 0)
+	usage();
+    }
+    else if(strcmp(argv[a], "--progress") == 0)
+      progress = serial = true;
+    else if(strcmp(argv[a], "--perf-counters") == 0)
+      PerfCounters::enable();
+    else if(strcmp(argv[a], "--serial") == 0)
+      serial = true;
+    else if(strcmp(argv[a], "--pipeline") == 0)
+      pipeline = true;
+    else if(strcmp(argv[a], "--export") == 0 && a + 1 < argc){
+      mode = EXPORT;
+      exportFile = argv[++a];
+    }
+    else if(strcmp(argv[a], "--checkpoint") == 0 && a + 1 < argc)
+      checkpointFile = argv[++a];
+    else if(strcmp(argv[a], "--checkpoint-every") == 0 && a + 1 < argc){
+      checkpointEvery = atol(argv[++a]);
+      if(checkpointEvery <= 0)
+	usage();
+    }
+    else if(strcmp(argv[a], "--resume") == 0)
+      resume = true;
+    else if(strcmp(argv[a], "--memory-budget") == 0 && a + 1 < argc){
+      memoryBudget = parseSize(argv[++a]);
+      if(memoryBudget == 0)
+	usage();
+    }
+    else if(strcmp(argv[a], "--stats") == 0)
+      mode = STATS;
+    else if(strcmp(argv[a], "--stats-json") == 0)
+      mode = STATS_JSON;
+    else if(strcmp(argv[a], "--sample") == 0 && a + 1 < argc){
+      mode = SAMPLE;
+      sampleRate = atof(argv[++a]);
+      if(sampleRate <= 0 || sampleRate > 1)
+	usage();
+    }
+    else if(strcmp(argv[a], "--window") == 0 && a + 1 < argc){
+      sampleWindow = atol(argv[++a]);
+      if(sampleWindow <= 0)
+	usage();
+    }
+    else if(strcmp(argv[a], "--warmup") == 0 && a + 1 < argc){
+      warmup = atol(argv[++a]);
+      if(warmup < 0)
+	usage();
+    }
+    else if(strcmp(argv[a], "--seed") == 0 && a + 1 < argc)
+      seed = strtoul(argv[++a], NULL, 0);
+    else if(strcmp(argv[a], "--critical-path") == 0)
+      mode = CRITICAL_PATH;
+    else if(strcmp(argv[a], "--cfg") == 0)
+      mode = CONTROL_FLOW;
+    else if(strcmp(argv[a], "--diff") == 0)
+      mode = DIFF;
+    else if(strcmp(argv[a], "--schedule") == 0)
+      mode = SCHEDULE;
+    else if(strcmp(argv[a], "--rename") == 0)
+      mode = RENAME;
+    else if(strcmp(argv[a], "--pool") == 0 && a + 1 < argc){
+      poolSize = atoi(argv[++a]);
+      if(poolSize <= NumRegisters)
+	usage();
+    }
+    else if(strcmp(argv[a], "--latency") == 0 && a + 1 < argc){
+      if(!latencies.parse(argv[++a]))
+	usage();
+    }
+    else if(strcmp(argv[a], "--depends-on") == 0 && a + 1 < argc){
+      query.active = true;
+      query.from = query.to = atoi(argv[++a]);
+    }
+    else if(strcmp(argv[a], "--dependents") == 0 && a + 1 < argc){
+      query.active = true;
+      query.producer = atoi(argv[++a]);
+    }
+    else if(strcmp(argv[a], "--from") == 0 && a + 1 < argc){
+      query.active = true;
+      query.from = atoi(argv[++a]);
+    }
+    else if(strcmp(argv[a], "--to") == 0 && a + 1 < argc){
+      query.active = true;
+      query.to = atoi(argv[++a]);
+    }
+    else if(strcmp(argv[a], "--register") == 0 && a + 1 < argc){
+      query.active = true;
+      query.reg = registers.getNum(argv[++a]);
+      if(query.reg == NumRegisters)
+	usage();
+    }
+    else if(strcmp(argv[a], "--type") == 0 && a + 1 < argc){
+      query.active = true;
+      a++;
+      query.type = D_UNDEFINED;
+      for(int t = 0; t < D_UNDEFINED; t++)
+	if(strcmp(argv[a], DependenceTypeName[t]) == 0)
+	  query.type = (DependenceType)t;
+      if(query.type == D_UNDEFINED)
+	usage();
+    }
+    else if(argv[a][0] == '-' && argv[a][1] == '-')
+      usage();
+    else if(input.filename == NULL)
+      input.filename = argv[a];
+    else if(newFile == NULL)
+      newFile = argv[a];
+    else
+      usage();
+  }
+  if(query.active && mode == REPORT)
+    mode = QUERY;
+  // binary input is disassembled only for the modes that print text
+  input.text = (mode == REPORT || mode == CONTROL_FLOW || mode == SCHEDULE ||
+		mode == RENAME);
+  // checkpoints cover the full dependence report only
+  if((checkpointFile != NULL || resume) &&
+     (checkpointFile == NULL || mode != REPORT || tail > 0))
+    usage();
+  if(memoryBudget > 0 && (mode != REPORT || tail > 0 || checkpointFile != NULL))
+    usage();
+
+  if(input.filename == NULL){
+    cerr << "Need to enter input file name" << endl;
+    exit(1);
+  }
+  if((mode == DIFF) != (newFile != NULL))
+    usage();
+
+  // prints the profile however main returns
+  struct PerfReport {
+    ~PerfReport() {
+      if(PerfCounters::enabled())
+	PerfCounters::print(cerr, instructionsRead);
+    };
+  } perfReport;
+
+  if(mode == SAMPLE){
+    Sampler sampler(sampleRate, sampleWindow, warmup, seed);
+    if(!withParser(input, [&sampler](auto &parser){ sampler.sample(parser); })){
+      cerr << "Format of input file is incorrect " << endl;
+      exit(1);
+    }
+    sampler.print(cout);
+    return 0;
+  }
+
+  if(mode == CRITICAL_PATH){
+    CriticalPath path(latencies);
+    readInput(input, [&](Instruction &i){ path.addInstruction(i); });
+    path.print(cout);
+    return 0;
+  }
+
+  if(mode == CONTROL_FLOW){
+    ControlFlowGraph cfg;
+    InstructionLog log(tail);
+    readInput(input, [&](Instruction &i, const vector<int> &labels){
+	cfg.addInstruction(i, labels);
+	log.append(i.getAssembly());
+      });
+    cfg.analyze(jobs);
+    cfg.printSummary(cerr);
+    if(!DependencyChecker::printReport(log, cfg.getDependences(), jobs))
+      exit(1);
+    return 0;
+  }
+
+  if(mode == DIFF){
+    DependenceDiff diff;
+    readInput(input, [&](Instruction &i){ diff.addInstruction(0, i); });
+    input.filename = newFile;
+    readInput(input, [&](Instruction &i){ diff.addInstruction(1, i); });
+    diff.analyze();
+    diff.print(cout);
+    return 0;
+  }
+
+  if(mode == SCHEDULE){
+    Scheduler scheduler(latencies);
+    readNamedInput(input, [&](Instruction &i, const vector<string> &labels){
+	scheduler.addInstruction(i, labels);
+      });
+    scheduler.schedule();
+    scheduler.print(cout, cerr);
+    return 0;
+  }
+
+  if(mode == RENAME){
+    Renamer renamer(cout, poolSize);
+    readNamedInput(input, [&](Instruction &i, const vector<string> &labels){
+	renamer.addInstruction(i, labels);
+      });
+    renamer.printCounts(cerr);
+    return 0;
+  }
+
+  DependencyChecker checker;
+  unique_ptr<ProgressMonitor> monitor;
+  if(progress)
+    monitor.reset(new ProgressMonitor(checker));
+
+  if(mode == STATS || mode == STATS_JSON){
+    DependenceStats stats;
+    checker.setListener(&stats, false);
+    readInput(input, [&](Instruction &i){ checker.addInstruction(i); });
+    if(mode == STATS)
+      stats.print(cout);
+    else
+      stats.printJSON(cout);
+    return 0;
+  }
+
+  if(mode == EXPORT){
+    ColumnExport columns;
+    readInput(input, [&](Instruction &i){
+	checker.addInstruction(i);
+	columns.addInstruction(i);
+      });
+    if(!columns.write(exportFile, checker)){
+      cerr << "Could not write " << exportFile << endl;
+      exit(1);
+    }
+    return 0;
+  }
+
+  if(mode == QUERY){
+    // the query output does not include instruction text
+    readInput(input, [&](Instruction &i){ checker.addInstruction(i); });
+    runQuery(checker, query);
+    return 0;
+  }
+
+  if(checkpointFile != NULL){
+    runCheckpointed(input, checker, checkpointFile, checkpointEvery, resume);
+    return 0;
+  }
+
+  if(memoryBudget > 0){
+    ExternalReport report(memoryBudget);
+    checker.setListener(&report, false);
+    readInput(input, [&](Instruction &i){ checker.addInstruction(i); });
+    if(!report.print(jobs)){
+      cerr << "Could not print the spilled report" << endl;
+      exit(1);
+    }
+    return 0;
+  }
+
+  // --tail needs the whole input before it knows which text to print, and
+  // on one processor the stages would only take turns
+  if(!serial && tail == 0 && (pipeline || thread::hardware_concurrency() > 1)){
+    runPipeline(input, jobs);
+    return 0;
+  }
+
+  InstructionLog log(tail);
+  readInput(input, [&](Instruction &i){
+      checker.addInstruction(i);
+      log.append(i.getAssembly());
+    });
+  if(!checker.printDependences(log, jobs))
+    exit(1);
 }
@@ -0,0 +1,25 @@
+#ifndef __DEPENDENCE_H__
+#define __DEPENDENCE_H__
+
+// The different types of possible data dependencies. 
+enum DependenceType{
+  RAW,                 // Read After Write
+  WAR,                 // Write After Read
+  WAW,                 // Write After Write
+  D_UNDEFINED
+};
+
+// Name of each DependenceType, as the reports print it
+inline constexpr const char *DependenceTypeName[D_UNDEFINED] = { "RAW", "WAR", "WAW" };
+
+/* The Dependence struct keeps track of the involved instructions, the register
+ * that the dependence involves, and what type of dependence.
+ */
+struct Dependence {
+  DependenceType dependenceType;        
+  unsigned int registerNumber;
+  int previousInstructionNumber;         // first instruction to occur
+  int currentInstructionNumber;          // second instruction to occur  
+};
+
+#endif
@@ -0,0 +1,374 @@
+#include "DependenceDiff.h"
+#include <unordered_map>
+#include <algorithm>
+
+DependenceDiff::DependenceDiff()
+  // Creates an empty comparison
+{
+  myNumAligned = 0;
+  myAdded = myRemoved = 0;
+}
+
+uint64_t DependenceDiff::hash(const Instruction &i)
+  // Returns the hash of the fields of i that identify it
+{
+  // label addresses are handed out in order of first use, so one new label
+  // would change the target of every later j; the target does not affect
+  // dependences, so a j is identified by its opcode alone
+  uint64_t h = i.getOpcode();
+  if(i.getOpcode() != J){
+    h = h * 0x9e3779b97f4a7c15ULL + i.getRS();
+    h = h * 0x9e3779b97f4a7c15ULL + i.getRT();
+    h = h * 0x9e3779b97f4a7c15ULL + i.getRD();
+    h = h * 0x9e3779b97f4a7c15ULL + (uint32_t)i.getImmediate();
+  }
+  // mix the high bits down (splitmix64 finalizer)
+  h ^= h >> 30;
+  h *= 0xbf58476d1ce4e5b9ULL;
+  h ^= h >> 27;
+  h *= 0x94d049bb133111ebULL;
+  h ^= h >> 31;
+  return h;
+}
+
+void DependenceDiff::addInstruction(int version, const Instruction &i)
+  // Adds the next instruction of the first (version 0) or second
+  // (version 1) version
+{
+  myCheckers[version].addInstruction(i);
+  myHashes[version].push_back(hash(i));
+}
+
+
+void DependenceDiff::align()
+  // Fills myAligned
+{
+  const vector<uint64_t> &a = myHashes[0];
+  const vector<uint64_t> &b = myHashes[1];
+  myAligned.assign(a.size(), -1);
+  myNumAligned = 0;
+
+  // Where a hash occurs in a gap, and how often
+  struct Occurrence {
+    size_t a, b;
+    int countA, countB;
+  };
+  unordered_map<uint64_t, Occurrence> occurrences;
+
+  // A part of both versions still to be aligned
+  struct Gap {
+    size_t aLo, aHi, bLo, bHi;
+  };
+  vector<Gap> gaps;
+  gaps.push_back(Gap{ 0, a.size(), 0, b.size() });
+
+  while(!gaps.empty()){
+    Gap g = gaps.back();
+    gaps.pop_back();
+
+    while(g.aLo < g.aHi && g.bLo < g.bHi && a[g.aLo] == b[g.bLo])
+      match(g.aLo++, g.bLo++);
+    while(g.aLo < g.aHi && g.bLo < g.bHi && a[g.aHi - 1] == b[g.bHi - 1])
+      match(--g.aHi, --g.bHi);
+    if(g.aLo == g.aHi || g.bLo == g.bHi)
+      continue;
+
+    // anchors: instructions that occur once on each side of the gap
+    occurrences.clear();
+    for(size_t k = g.aLo; k < g.aHi; k++){
+      Occurrence &o = occurrences.emplace(a[k], Occurrence{ 0, 0, 0, 0 }).first->second;
+      o.a = k;
+      o.countA++;
+    }
+    for(size_t k = g.bLo; k < g.bHi; k++){
+      unordered_map<uint64_t, Occurrence>::iterator it = occurrences.find(b[k]);
+      if(it != occurrences.end()){
+	it->second.b = k;
+	it->second.countB++;
+      }
+    }
+    vector<size_t> anchorA, anchorB;
+    for(size_t k = g.aLo; k < g.aHi; k++){
+      const Occurrence &o = occurrences[a[k]];
+      if(o.countA == 1 && o.countB == 1){
+	anchorA.push_back(k);
+	anchorB.push_back(o.b);
+      }
+    }
+
+    if(anchorA.empty()){
+      // nothing to anchor on (e.g. repetitive code)
+      alignEdits(g.aLo, g.aHi, g.bLo, g.bHi);
+      continue;
+    }
+
+    // the longest run of anchors in the same order on both sides
+    // (patience sorting: tails[l] ends the best run of length l + 1)
+    vector<size_t> tails, previous(anchorA.size());
+    for(size_t k = 0; k < anchorA.size(); k++){
+      size_t l = lower_bound(tails.begin(), tails.end(), k, [&anchorB](size_t t, size_t v){
+	  return anchorB[t] < anchorB[v];
+	}) - tails.begin();
+      previous[k] = l > 0 ? tails[l - 1] : k;
+      if(l == tails.size())
+	tails.push_back(k);
+      else
+	tails[l] = k;
+    }
+
+    // align the run and queue the gaps around its anchors
+    size_t aHi = g.aHi, bHi = g.bHi;
+    for(size_t k = tails.back(); ; k = previous[k]){
+      match(anchorA[k], anchorB[k]);
+      gaps.push_back(Gap{ anchorA[k] + 1, aHi, anchorB[k] + 1, bHi });
+      aHi = anchorA[k];
+      bHi = anchorB[k];
+      if(previous[k] == k)
+	break;
+    }
+    gaps.push_back(Gap{ g.aLo, aHi, g.bLo, bHi });
+  }
+
+  // what is left between two aligned instructions, if it has the same
+  // length in both versions, was rewritten in place
+  size_t x = 0, y = 0;
+  while(x < a.size()){
+    if(myAligned[x] != -1){
+      y = myAligned[x++] + 1;
+      continue;
+    }
+    size_t end = x;
+    while(end < a.size() && myAligned[end] == -1)
+      end++;
+    size_t next = end < a.size() ? myAligned[end] : b.size();
+    if(next - y == end - x)
+      for(; x < end; x++)
+	match(x, y++);
+    x = end;
+  }
+}
+
+void DependenceDiff::match(size_t x, size_t y)
+  // Aligns instruction x of version 0 with instruction y of version 1
+{
+  myAligned[x] = y;
+  myNumAligned++;
+}
+
+void DependenceDiff::alignEdits(size_t aLo, size_t aHi, size_t bLo, size_t bHi)
+  /* Aligns instructions [aLo, aHi) of version 0 with [bLo, bHi) of version 1
+   * by few insertions and deletions, a window at a time: what matches is
+   * skipped, then the shortest edit path through the next EditWindow
+   * instructions of each side is kept up to the middle of the window (where
+   * the cut at its end no longer matters), and aligning goes on from there.
+   * Where a window needs more than MaxEdits edits the window is halved,
+   * down to MinEditWindow, which is left unaligned if it still needs more;
+   * after each success it doubles again, up to EditWindow.
+   */
+{
+  const vector<uint64_t> &a = myHashes[0];
+  const vector<uint64_t> &b = myHashes[1];
+  vector< pair<size_t, size_t> > path;
+  size_t window = EditWindow;
+
+  while(true){
+    while(aLo < aHi && bLo < bHi && a[aLo] == b[bLo])
+      match(aLo++, bLo++);
+    if(aLo == aHi || bLo == bHi)
+      return;
+
+    size_t aEnd = min(aHi, aLo + window);
+    size_t bEnd = min(bHi, bLo + window);
+    bool last = (aEnd == aHi && bEnd == bHi);
+    path.clear();
+    if(!shortestEdit(aLo, aEnd, bLo, bEnd, path)){
+      if(window > MinEditWindow)
+	window /= 2;
+      else{
+	aLo = aEnd;
+	bLo = bEnd;
+      }
+      continue;
+    }
+    window = min(2 * window, EditWindow);
+    if(path.empty()){
+      // nothing in the window is alike
+      if(last)
+	return;
+      aLo = aEnd;
+      bLo = bEnd;
+      continue;
+    }
+
+    // path holds the aligned pairs last first
+    size_t aMiddle = last ? aHi : aLo + (aEnd - aLo) / 2;
+    size_t bMiddle = last ? bHi : bLo + (bEnd - bLo) / 2;
+    size_t kept = 0;
+    for(size_t k = path.size(); k-- > 0; ){
+      if(kept > 0 && (path[k].first >= aMiddle || path[k].second >= bMiddle))
+	break;
+      match(path[k].first, path[k].second);
+      kept++;
+    }
+    if(last)
+      return;
+    aLo = path[path.size() - kept].first + 1;
+    bLo = path[path.size() - kept].second + 1;
+  }
+}
+
+bool DependenceDiff::shortestEdit(size_t aLo, size_t aHi, size_t bLo, size_t bHi,
+				  vector< pair<size_t, size_t> > &path) const
+  /* Finds the fewest insertions and deletions that turn instructions
+   * [aLo, aHi) of version 0 into [bLo, bHi) of version 1 (Myers' O(ND)
+   * algorithm) and appends the pairs of instructions they leave aligned to
+   * path, last pair first.  Returns false if more than MaxEdits are needed.
+   */
+{
+  const vector<uint64_t> &a = myHashes[0];
+  const vector<uint64_t> &b = myHashes[1];
+  long n = aHi - aLo, m = bHi - bLo;
+  long most = min<long>(n + m, MaxEdits);
+
+  // furthest[k + most + 1]: furthest x reached on diagonal k = x - y, kept
+  // for every number of edits to trace the path back
+  vector<long> furthest(2 * most + 3, 0);
+  vector< vector<long> > trace;
+  for(long d = 0; d <= most; d++){
+    trace.push_back(furthest);
+    for(long k = -d; k <= d; k += 2){
+      long *v = &furthest[k + most + 1];
+      long x = (k == -d || (k != d && v[-1] < v[1])) ? v[1] : v[-1] + 1;
+      long y = x - k;
+      while(x < n && y < m && a[aLo + x] == b[bLo + y])
+	x++, y++;
+      *v = x;
+      if(x < n || y < m)
+	continue;
+
+      // walk back along the path, keeping its diagonal moves
+      for(long e = d; e >= 0; e--){
+	const long *w = &trace[e][x - y + most + 1];
+	bool down = (x - y == -e || (x - y != e && w[-1] < w[1]));
+	long px = down ? w[1] : w[-1];
+	long py = px - (down ? x - y + 1 : x - y - 1);
+	while(x > px && y > py){
+	  x--, y--;
+	  path.push_back(make_pair(aLo + x, bLo + y));
+	}
+	x = px;
+	y = py;
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+bool DependenceDiff::precedes(const Hazard &x, const Hazard &y)
+  // Returns true if x comes before y in (consumer, producer, register,
+  // type) order
+{
+  if(x.consumer != y.consumer)
+    return x.consumer < y.consumer;
+  if(x.producer != y.producer)
+    return x.producer < y.producer;
+  if(x.reg != y.reg)
+    return x.reg < y.reg;
+  return x.type < y.type;
+}
+
+vector<DependenceDiff::Hazard> DependenceDiff::hazards(int v) const
+  // Returns the dependences of version v in the second version's
+  // numbering, ordered by (consumer, producer, register, type)
+{
+  vector<Hazard> result;
+  myCheckers[v].forEachDependence([&](const Dependence &d){
+      Hazard h;
+      h.consumer = d.currentInstructionNumber;
+      h.producer = d.previousInstructionNumber;
+      if(v == 0){
+	h.consumer = myAligned[h.consumer];
+	h.producer = myAligned[h.producer];
+      }
+      h.reg = d.registerNumber;
+      h.type = d.dependenceType;
+      h.original = d;
+      result.push_back(h);
+    });
+
+  // the alignment keeps the order of instructions, so the hazards are
+  // already ordered by consumer, except those with no consumer; only the
+  // few hazards of each consumer need sorting
+  size_t start = 0;
+  for(size_t k = 1; k <= result.size(); k++)
+    if(k == result.size() || result[k].original.currentInstructionNumber !=
+       result[start].original.currentInstructionNumber){
+      sort(result.begin() + start, result.begin() + k, precedes);
+      start = k;
+    }
+  return result;
+}
+
+void DependenceDiff::analyze()
+  // Aligns the versions and compares their dependences
+{
+  align();
+  vector<Hazard> first = hazards(0);
+  vector<Hazard> second = hazards(1);
+
+  myChanges.clear();
+  myAdded = myRemoved = 0;
+  auto removed = [this](const Hazard &h){
+    myChanges.push_back(Change{ false, h.original });
+    myRemoved++;
+  };
+  auto added = [this](const Hazard &h){
+    myChanges.push_back(Change{ true, h.original });
+    myAdded++;
+  };
+
+  size_t x = 0, y = 0;
+  while(x < first.size() || y < second.size()){
+    if(x < first.size() && (first[x].consumer == -1 || first[x].producer == -1)){
+      // an instruction of the dependence is gone
+      removed(first[x++]);
+      continue;
+    }
+    if(y == second.size()){
+      removed(first[x++]);
+      continue;
+    }
+    if(x == first.size()){
+      added(second[y++]);
+      continue;
+    }
+
+    if(precedes(first[x], second[y]))
+      removed(first[x++]);
+    else if(precedes(second[y], first[x]))
+      added(second[y++]);
+    else{
+      x++;
+      y++;
+    }
+  }
+}
+
+void DependenceDiff::print(ostream &out) const
+  /* Prints the number of instructions aligned, then every dependence that
+   * was removed ("-", numbered as in the first version) or added ("+",
+   * numbered as in the second), in the format of printDependences.
+   */
+{
+  out << "ALIGNED: " << myNumAligned << " of " << myHashes[0].size() << " and "
+      << myHashes[1].size() << " instructions" << endl;
+  out << "DEPENDENCES: removed " << myRemoved << ", added " << myAdded
+      << "\nType Register (FirstInstr#, SecondInstr#) " << endl;
+  string line;
+  for(const Change &c : myChanges){
+    line = c.added ? "+ " : "- ";
+    DependencyChecker::formatDependence(line, c.d);
+    out << line;
+  }
+}
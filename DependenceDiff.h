@@ -0,0 +1,128 @@
+#ifndef __DEPENDENCEDIFF_H__
+#define __DEPENDENCEDIFF_H__
+
+#include <iostream>
+#include <vector>
+#include <stdint.h>
+
+using namespace std;
+
+#include "Instruction.h"
+#include "DependencyChecker.h"
+
+/* This class compares the dependences of two versions of a program, e.g.
+ * the code a compiler generated before and after a change, and reports the
+ * hazards that appeared or disappeared.
+ *
+ * The instructions of the two versions are aligned first.  Every
+ * instruction is reduced to a hash of its decoded fields, so spacing and
+ * register names ($t0 or $8) do not matter.  Matching prefixes and suffixes
+ * are aligned directly; in between, instructions that occur exactly once in
+ * each version are anchors, the longest run of anchors in the same order in
+ * both is aligned, and the gaps between anchors are aligned the same way.
+ * A gap without anchors (e.g. in repetitive code) is aligned by shortest
+ * edit paths through windows of at most EditWindow instructions, so however
+ * many edits the gap has, only those near each other cost time.  Last,
+ * instructions left between two aligned ones are aligned by position if
+ * there are as many in both versions, as a stretch rewritten in place.  For
+ * versions that are mostly alike this takes time about linear in their
+ * length.
+ *
+ * A dependence of the first version is then renumbered to the second
+ * version's instructions; one whose instructions have no counterpart was
+ * removed.  Since the alignment keeps the order of instructions, both lists
+ * stay ordered by second instruction, and one merge on (second instruction,
+ * first instruction, register, type) finds the dependences in only one of
+ * them.
+ */
+class DependenceDiff {
+ public:
+  // Creates an empty comparison
+  DependenceDiff();
+
+  // Adds the next instruction of the first (version 0) or second
+  // (version 1) version
+  void addInstruction(int version, const Instruction &i);
+
+  // Aligns the versions and compares their dependences
+  void analyze();
+
+  /* Prints the number of instructions aligned, then every dependence that
+   * was removed ("-", numbered as in the first version) or added ("+",
+   * numbered as in the second), in the format of printDependences.
+   */
+  void print(ostream &out) const;
+
+  // Returns the number of dependences added and removed
+  size_t numAdded() const { return myAdded; };
+  size_t numRemoved() const { return myRemoved; };
+
+ private:
+  // A dependence placed in the second version's numbering
+  struct Hazard {
+    int consumer;             // aligned second instruction, or -1
+    int producer;             // aligned first instruction, or -1
+    unsigned int reg;
+    DependenceType type;
+    Dependence original;      // as numbered in its own version
+  };
+
+  DependencyChecker myCheckers[2];
+  vector<uint64_t> myHashes[2];      // one per instruction
+  vector<int> myAligned;             // instruction of version 1 for each of version 0, or -1
+  size_t myNumAligned;
+
+  // A dependence in only one of the versions
+  struct Change {
+    bool added;               // only in the second version, else only in the first
+    Dependence d;             // as numbered in that version
+  };
+
+  vector<Change> myChanges;          // results of analyze, in order
+  size_t myAdded;
+  size_t myRemoved;
+
+  // Returns the hash of the fields of i that identify it
+  static uint64_t hash(const Instruction &i);
+
+  // Instructions of each side in one window of alignEdits (at most and at
+  // least), and the most insertions and deletions looked for in it
+  static const size_t EditWindow = 4096;
+  static const size_t MinEditWindow = 64;
+  static const long MaxEdits = 128;
+
+  // Fills myAligned
+  void align();
+
+  // Aligns instruction x of version 0 with instruction y of version 1
+  void match(size_t x, size_t y);
+
+  /* Aligns instructions [aLo, aHi) of version 0 with [bLo, bHi) of version 1
+   * by few insertions and deletions, a window at a time: what matches is
+   * skipped, then the shortest edit path through the next EditWindow
+   * instructions of each side is kept up to the middle of the window (where
+   * the cut at its end no longer matters), and aligning goes on from there.
+   * Where a window needs more than MaxEdits edits the window is halved,
+   * down to MinEditWindow, which is left unaligned if it still needs more;
+   * after each success it doubles again, up to EditWindow.
+   */
+  void alignEdits(size_t aLo, size_t aHi, size_t bLo, size_t bHi);
+
+  /* Finds the fewest insertions and deletions that turn instructions
+   * [aLo, aHi) of version 0 into [bLo, bHi) of version 1 (Myers' O(ND)
+   * algorithm) and appends the pairs of instructions they leave aligned to
+   * path, last pair first.  Returns false if more than MaxEdits are needed.
+   */
+  bool shortestEdit(size_t aLo, size_t aHi, size_t bLo, size_t bHi,
+		    vector< pair<size_t, size_t> > &path) const;
+
+  // Returns true if x comes before y in (consumer, producer, register,
+  // type) order
+  static bool precedes(const Hazard &x, const Hazard &y);
+
+  // Returns the dependences of version v in the second version's
+  // numbering, ordered by (consumer, producer, register, type)
+  vector<Hazard> hazards(int v) const;
+};
+
+#endif
@@ -0,0 +1,128 @@
+#include "DependenceIndex.h"
+#include <algorithm>
+
+// Orderings used by the indexes.  Ties keep the order in which the checker
+// found the dependences (the sorts are stable).
+static bool lessConsumer(const Dependence &a, const Dependence &b)
+{
+  return a.currentInstructionNumber < b.currentInstructionNumber;
+}
+
+static bool lessProducer(const Dependence &a, const Dependence &b)
+{
+  if(a.previousInstructionNumber != b.previousInstructionNumber)
+    return a.previousInstructionNumber < b.previousInstructionNumber;
+  return a.currentInstructionNumber < b.currentInstructionNumber;
+}
+
+static bool lessType(const Dependence &a, const Dependence &b)
+{
+  if(a.dependenceType != b.dependenceType)
+    return a.dependenceType < b.dependenceType;
+  return a.currentInstructionNumber < b.currentInstructionNumber;
+}
+
+static bool lessRegister(const Dependence &a, const Dependence &b)
+{
+  if(a.registerNumber != b.registerNumber)
+    return a.registerNumber < b.registerNumber;
+  return a.currentInstructionNumber < b.currentInstructionNumber;
+}
+
+static bool lessRegType(const Dependence &a, const Dependence &b)
+{
+  if(a.registerNumber != b.registerNumber)
+    return a.registerNumber < b.registerNumber;
+  if(a.dependenceType != b.dependenceType)
+    return a.dependenceType < b.dependenceType;
+  return a.currentInstructionNumber < b.currentInstructionNumber;
+}
+
+
+DependenceIndex::DependenceIndex(const DependencyChecker &checker)
+  // Builds the index from every dependence the checker has found so far
+{
+  myByConsumer.reserve(checker.numDependences());
+  checker.forEachDependence([this](const Dependence &d){ myByConsumer.push_back(d); });
+
+  // The checker finds dependences in instruction order, but sort anyway so
+  // the index does not depend on that.
+  stable_sort(myByConsumer.begin(), myByConsumer.end(), lessConsumer);
+}
+
+
+template<class Less>
+const vector<Dependence> &DependenceIndex::sortedBy(vector<Dependence> &sorted,
+						    Less less) const
+  // Returns sorted, a copy of myByConsumer sorted by less, sorting it first
+  // if it is not built yet
+{
+  if(sorted.size() != myByConsumer.size()){
+    sorted = myByConsumer;
+    stable_sort(sorted.begin(), sorted.end(), less);
+  }
+  return sorted;
+}
+
+
+template<class Less>
+DependenceRange DependenceIndex::equalRange(const vector<Dependence> &v,
+					    const Dependence &lo, const Dependence &hi,
+					    Less less)
+  // Returns the run of v whose sort key lies between the keys of lo and hi,
+  // using less to compare records
+{
+  DependenceRange r;
+  const Dependence *b = v.data();
+  const Dependence *e = v.data() + v.size();
+  r.first = lower_bound(b, e, lo, less);
+  r.last = upper_bound(r.first, e, hi, less);
+  return r;
+}
+
+
+DependenceRange DependenceIndex::find(int from, int to,
+				      DependenceType type, int reg) const
+  /* Returns the dependences whose second instruction (the one that depends on
+   * an earlier one) lies in [from, to].  If type is not D_UNDEFINED only
+   * dependences of that type are returned; if reg is not -1 only dependences
+   * on that register are returned.  Results are ordered by second instruction.
+   */
+{
+  Dependence lo, hi;
+  lo.dependenceType = hi.dependenceType = type;
+  lo.registerNumber = hi.registerNumber = reg;
+  lo.previousInstructionNumber = hi.previousInstructionNumber = 0;
+  lo.currentInstructionNumber = from;
+  hi.currentInstructionNumber = to;
+
+  if(from > to){
+    DependenceRange none = { NULL, NULL };
+    return none;
+  }
+  if(reg != -1 && type != D_UNDEFINED)
+    return equalRange(sortedBy(myByRegType, lessRegType), lo, hi, lessRegType);
+  if(reg != -1)
+    return equalRange(sortedBy(myByRegister, lessRegister), lo, hi, lessRegister);
+  if(type != D_UNDEFINED)
+    return equalRange(sortedBy(myByType, lessType), lo, hi, lessType);
+  return equalRange(myByConsumer, lo, hi, lessConsumer);
+}
+
+DependenceRange DependenceIndex::dependents(int from, int to) const
+  /* Returns the dependences whose first instruction (the earlier one) lies in
+   * [from, to], ordered by first instruction.
+   */
+{
+  Dependence lo, hi;
+  lo.previousInstructionNumber = from;
+  hi.previousInstructionNumber = to;
+  lo.currentInstructionNumber = INT_MIN;
+  hi.currentInstructionNumber = INT_MAX;
+
+  if(from > to){
+    DependenceRange none = { NULL, NULL };
+    return none;
+  }
+  return equalRange(sortedBy(myByProducer, lessProducer), lo, hi, lessProducer);
+}
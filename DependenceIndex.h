@@ -0,0 +1,77 @@
+#ifndef __DEPENDENCEINDEX_H__
+#define __DEPENDENCEINDEX_H__
+
+#include <vector>
+#include <climits>
+
+using namespace std;
+
+#include "DependencyChecker.h"
+
+/* A contiguous run of Dependence records returned by a DependenceIndex query.
+ * It can be used in a range-based for loop.
+ */
+struct DependenceRange {
+  const Dependence *first;
+  const Dependence *last;
+
+  const Dependence *begin() const { return first; };
+  const Dependence *end() const   { return last; };
+  size_t size() const             { return last - first; };
+  bool empty() const              { return first == last; };
+};
+
+
+/* This class answers lookups over the dependences found by a DependencyChecker
+ * without rescanning them.  The dependences are copied into arrays sorted by
+ * the key of each kind of query, so every query is two binary searches and
+ * returns its k results as one DependenceRange: O(log n + k).  Only the
+ * array by second instruction is built up front; each of the others is
+ * sorted the first time a query needs it.  Queries therefore modify the
+ * index: an index must not be queried from several threads at once.
+ */
+class DependenceIndex {
+ public:
+  // Builds the index from every dependence the checker has found so far
+  DependenceIndex(const DependencyChecker &checker);
+
+  /* Returns the dependences whose second instruction (the one that depends on
+   * an earlier one) lies in [from, to].  If type is not D_UNDEFINED only
+   * dependences of that type are returned; if reg is not -1 only dependences
+   * on that register are returned.  Results are ordered by second instruction.
+   */
+  DependenceRange find(int from, int to = INT_MAX,
+		       DependenceType type = D_UNDEFINED, int reg = -1) const;
+
+  // Returns the dependences of instruction k on earlier instructions
+  DependenceRange dependsOn(int k) const { return find(k, k); };
+
+  /* Returns the dependences whose first instruction (the earlier one) lies in
+   * [from, to], ordered by first instruction.
+   */
+  DependenceRange dependents(int from, int to = INT_MAX) const;
+
+  // Returns the number of dependences in the index
+  size_t size() const { return myByConsumer.size(); };
+
+ private:
+  vector<Dependence> myByConsumer;            // by second instruction
+  mutable vector<Dependence> myByProducer;    // by first instruction, second instruction
+  mutable vector<Dependence> myByType;        // by type, second instruction
+  mutable vector<Dependence> myByRegister;    // by register, second instruction
+  mutable vector<Dependence> myByRegType;     // by register, type, second instruction
+
+  // Returns sorted, a copy of myByConsumer sorted by less, sorting it first
+  // if it is not built yet
+  template<class Less>
+  const vector<Dependence> &sortedBy(vector<Dependence> &sorted, Less less) const;
+
+  // Returns the run of v whose sort key lies between the keys of lo and hi,
+  // using less to compare records
+  template<class Less>
+  static DependenceRange equalRange(const vector<Dependence> &v,
+				    const Dependence &lo, const Dependence &hi,
+				    Less less);
+};
+
+#endif
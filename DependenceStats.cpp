@@ -0,0 +1,134 @@
+#include "DependenceStats.h"
+#include <string.h>
+
+DependenceStats::DependenceStats()
+  // Creates empty statistics
+{
+  myInstructions = 0;
+  memset(myTypeCount, 0, sizeof(myTypeCount));
+  memset(myRegister, 0, sizeof(myRegister));
+  memset(myDistance, 0, sizeof(myDistance));
+  memset(myOpcodeCount, 0, sizeof(myOpcodeCount));
+  memset(myOpcodeHazards, 0, sizeof(myOpcodeHazards));
+}
+
+void DependenceStats::dependenceFound(const Dependence &d, Opcode consumer)
+  // Counts d
+{
+  DependenceType t = d.dependenceType;
+  if(t >= D_UNDEFINED)
+    return;
+  myTypeCount[t]++;
+  if(d.registerNumber < (unsigned)NumRegisters)
+    myRegister[d.registerNumber][t]++;
+  myDistance[t][bucket(d.currentInstructionNumber - d.previousInstructionNumber)]++;
+  myOpcodeHazards[consumer][t]++;
+}
+
+void DependenceStats::instructionAdded(const Instruction &i)
+  // Counts i
+{
+  myInstructions++;
+  myOpcodeCount[i.getOpcode()]++;
+}
+
+void DependenceStats::merge(const DependenceStats &other)
+  // Adds the counts of other to these
+{
+  myInstructions += other.myInstructions;
+  for(int t = 0; t < D_UNDEFINED; t++){
+    myTypeCount[t] += other.myTypeCount[t];
+    for(int r = 0; r < NumRegisters; r++)
+      myRegister[r][t] += other.myRegister[r][t];
+    for(int b = 0; b < NumBuckets; b++)
+      myDistance[t][b] += other.myDistance[t][b];
+    for(int o = 0; o <= UNDEFINED; o++)
+      myOpcodeHazards[o][t] += other.myOpcodeHazards[o][t];
+  }
+  for(int o = 0; o <= UNDEFINED; o++)
+    myOpcodeCount[o] += other.myOpcodeCount[o];
+}
+
+
+void DependenceStats::print(ostream &out) const
+  // Prints a compact text report
+{
+  out << "INSTRUCTIONS: " << myInstructions << endl;
+  out << "DEPENDENCES: RAW " << myTypeCount[RAW] << " WAR " << myTypeCount[WAR]
+      << " WAW " << myTypeCount[WAW] << endl;
+
+  out << "BY REGISTER: Register RAW WAR WAW" << endl;
+  for(int r = 0; r < NumRegisters; r++){
+    if(myRegister[r][RAW] + myRegister[r][WAR] + myRegister[r][WAW] == 0)
+      continue;
+    out << "$" << r << " \t" << myRegister[r][RAW] << " \t" << myRegister[r][WAR]
+	<< " \t" << myRegister[r][WAW] << endl;
+  }
+
+  out << "DISTANCES: [from, to) RAW WAR WAW" << endl;
+  for(int b = 0; b < NumBuckets; b++){
+    if(myDistance[RAW][b] + myDistance[WAR][b] + myDistance[WAW][b] == 0)
+      continue;
+    uint64_t lo = b == 0 ? 0 : (uint64_t)1 << (b - 1);
+    uint64_t hi = (uint64_t)1 << b;
+    out << "[" << lo << ", " << hi << ") \t" << myDistance[RAW][b] << " \t"
+	<< myDistance[WAR][b] << " \t" << myDistance[WAW][b] << endl;
+  }
+
+  out << "BY OPCODE: Opcode Count RAW/instr WAR/instr WAW/instr" << endl;
+  out.setf(ios::fixed);
+  out.precision(3);
+  for(int o = 0; o < UNDEFINED; o++){
+    if(myOpcodeCount[o] == 0)
+      continue;
+    double n = myOpcodeCount[o];
+    out << OpcodeInfoTable[o].name << " \t" << myOpcodeCount[o] << " \t"
+	<< myOpcodeHazards[o][RAW] / n << " \t" << myOpcodeHazards[o][WAR] / n
+	<< " \t" << myOpcodeHazards[o][WAW] / n << endl;
+  }
+  out.unsetf(ios::fixed);
+}
+
+void DependenceStats::printJSON(ostream &out) const
+  // Prints the statistics as a JSON object
+{
+  out << "{\"instructions\": " << myInstructions << ", \"dependences\": {";
+  for(int t = 0; t < D_UNDEFINED; t++)
+    out << (t ? ", " : "") << "\"" << DependenceTypeName[t] << "\": " << myTypeCount[t];
+  out << "},\n \"registers\": {";
+
+  bool first = true;
+  for(int r = 0; r < NumRegisters; r++){
+    if(myRegister[r][RAW] + myRegister[r][WAR] + myRegister[r][WAW] == 0)
+      continue;
+    out << (first ? "" : ", ") << "\"$" << r << "\": [" << myRegister[r][RAW]
+	<< ", " << myRegister[r][WAR] << ", " << myRegister[r][WAW] << "]";
+    first = false;
+  }
+
+  // histograms are trimmed after the last non-empty bucket
+  out << "},\n \"distance_buckets\": {";
+  for(int t = 0; t < D_UNDEFINED; t++){
+    int last = NumBuckets - 1;
+    while(last > 0 && myDistance[t][last] == 0)
+      last--;
+    out << (t ? ", " : "") << "\"" << DependenceTypeName[t] << "\": [";
+    for(int b = 0; b <= last; b++)
+      out << (b ? ", " : "") << myDistance[t][b];
+    out << "]";
+  }
+
+  out << "},\n \"opcodes\": {";
+  first = true;
+  for(int o = 0; o < UNDEFINED; o++){
+    if(myOpcodeCount[o] == 0)
+      continue;
+    out << (first ? "" : ", ") << "\"" << OpcodeInfoTable[o].name << "\": {\"count\": "
+	<< myOpcodeCount[o];
+    for(int t = 0; t < D_UNDEFINED; t++)
+      out << ", \"" << DependenceTypeName[t] << "\": " << myOpcodeHazards[o][t];
+    out << "}";
+    first = false;
+  }
+  out << "}}" << endl;
+}
@@ -0,0 +1,82 @@
+#ifndef __DEPENDENCESTATS_H__
+#define __DEPENDENCESTATS_H__
+
+#include <iostream>
+#include <stdint.h>
+
+using namespace std;
+
+#include "Dependence.h"
+#include "Instruction.h"
+#include "OpcodeTable.h"
+#include "RegisterTable.h"
+
+/* Receives dependences from a DependencyChecker as they are found (see
+ * DependencyChecker::setListener).
+ */
+class DependenceListener {
+ public:
+  virtual ~DependenceListener() {};
+
+  // Called for every dependence found; consumer is the opcode of the second
+  // instruction of the dependence
+  virtual void dependenceFound(const Dependence &d, Opcode consumer) = 0;
+
+  // Called after every instruction has been checked
+  virtual void instructionAdded(const Instruction &i) {};
+};
+
+
+/* Aggregate statistics of the dependences of a program, updated in place as
+ * each dependence is found, so no dependence is ever stored: counts per
+ * register and type, a histogram of producer-consumer distances per type in
+ * power-of-two buckets, and per-opcode hazard counts.  Memory is fixed at
+ * O(registers x buckets).
+ */
+class DependenceStats : public DependenceListener {
+ public:
+  // Number of distance buckets: bucket 0 holds distance 0 and bucket b > 0
+  // holds distances in [2^(b-1), 2^b)
+  static const int NumBuckets = 33;
+
+  // Creates empty statistics
+  DependenceStats();
+
+  // Counts d
+  void dependenceFound(const Dependence &d, Opcode consumer);
+
+  // Counts i
+  void instructionAdded(const Instruction &i);
+
+  // Adds the counts of other to these
+  void merge(const DependenceStats &other);
+
+  // Returns the number of dependences of type t
+  uint64_t count(DependenceType t) const { return myTypeCount[t]; };
+
+  // Returns the number of dependences of type t with distance in bucket b
+  uint64_t bucketCount(DependenceType t, int b) const { return myDistance[t][b]; };
+
+  // Returns the number of instructions counted
+  uint64_t numInstructions() const { return myInstructions; };
+
+  // Returns the distance bucket of distance
+  static int bucket(uint64_t distance)
+    { return distance == 0 ? 0 : 64 - __builtin_clzll(distance); };
+
+  // Prints a compact text report
+  void print(ostream &out) const;
+
+  // Prints the statistics as a JSON object
+  void printJSON(ostream &out) const;
+
+ private:
+  uint64_t myInstructions;
+  uint64_t myTypeCount[D_UNDEFINED];
+  uint64_t myRegister[NumRegisters][D_UNDEFINED];
+  uint64_t myDistance[D_UNDEFINED][NumBuckets];
+  uint64_t myOpcodeCount[UNDEFINED + 1];
+  uint64_t myOpcodeHazards[UNDEFINED + 1][D_UNDEFINED];
+};
+
+#endif
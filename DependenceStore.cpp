@@ -0,0 +1,98 @@
+#include "DependenceStore.h"
+
+DependenceStore::DependenceStore()
+  // Creates an empty store
+  : myCount(0)
+{
+  myEnd = myLimit = NULL;
+  myLastCurrent = 0;
+}
+
+DependenceStore::~DependenceStore()
+  // Frees the chunks
+{
+  clear();
+}
+
+void DependenceStore::clear()
+  // Removes every dependence.  No other thread may be reading.
+{
+  for(uint8_t *chunk : myChunks)
+    delete [] chunk;
+  myChunks.clear();
+  myBlocks.clear();
+  myEnd = myLimit = NULL;
+  myCount.store(0, memory_order_relaxed);
+  myLastCurrent = 0;
+}
+
+void DependenceStore::append(const Dependence &d)
+  // Appends d.  Only one thread may append.
+{
+  size_t count = myCount.load(memory_order_relaxed);
+  if(count % BlockSize == 0){
+    // a block never spans two chunks
+    if((size_t)(myLimit - myEnd) < MaxBlockBytes){
+      myChunks.push_back(new uint8_t[ChunkBytes]);
+      myEnd = myChunks.back();
+      myLimit = myEnd + ChunkBytes;
+    }
+    Checkpoint c = { myEnd, myLastCurrent };
+    myBlocks.push_back(c);
+  }
+
+  myEnd = putVarint(myEnd, (int64_t)d.currentInstructionNumber - myLastCurrent);
+  *myEnd++ = (uint8_t)((d.dependenceType << 6) | (d.registerNumber & 0x3f));
+  myEnd = putVarint(myEnd, (int64_t)d.currentInstructionNumber - d.previousInstructionNumber);
+
+  myLastCurrent = d.currentInstructionNumber;
+  myCount.store(count + 1, memory_order_release);
+}
+
+void DependenceStore::encode(string &out) const
+  // Appends every dependence to out in the encoding above, as one stream
+  // without blocks, starting from second instruction 0
+{
+  int64_t current = 0;
+  forEach([&](const Dependence &d){
+      uint8_t entry[MaxBlockBytes / BlockSize];
+      uint8_t *p = putVarint(entry, (int64_t)d.currentInstructionNumber - current);
+      *p++ = (uint8_t)((d.dependenceType << 6) | (d.registerNumber & 0x3f));
+      p = putVarint(p, (int64_t)d.currentInstructionNumber - d.previousInstructionNumber);
+      out.append((const char *)entry, p - entry);
+      current = d.currentInstructionNumber;
+    });
+}
+
+DependenceStore::Encoded::Encoded(const uint8_t *p, const uint8_t *end)
+  // Indexes the stream [p, end), which must outlive this
+{
+  // Returns true if a whole dependence starts at q
+  auto whole = [end](const uint8_t *q){
+    while(q < end && (*q & 0x80))
+      q++;
+    q += 2;           // the last byte of the varint and the type/register byte
+    while(q < end && (*q & 0x80))
+      q++;
+    return q < end;
+  };
+
+  int64_t current = 0;
+  myCount = 0;
+  myComplete = true;
+  while(p < end){
+    // only the last few dependences could be cut off
+    if(end - p < (ptrdiff_t)(MaxBlockBytes / BlockSize) && !whole(p)){
+      myComplete = false;
+      return;
+    }
+    if(myCount % BlockSize == 0){
+      Checkpoint c = { p, current };
+      myBlocks.push_back(c);
+    }
+    current += getVarint(p);
+    p++;
+    getVarint(p);
+    myCount++;
+  }
+}
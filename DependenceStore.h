@@ -0,0 +1,227 @@
+#ifndef __DEPENDENCESTORE_H__
+#define __DEPENDENCESTORE_H__
+
+#include <vector>
+#include <string>
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+using namespace std;
+
+#include "Dependence.h"
+#include "ChunkedArray.h"
+
+/* Compact storage for a long sequence of dependences, appended in order of
+ * their second instruction.  Each dependence is encoded in a few bytes:
+ *
+ *   varint   second instruction - second instruction of the previous entry
+ *   1 byte   dependence type (2 bits) and register number (6 bits)
+ *   varint   second instruction - first instruction (the distance)
+ *
+ * Both varints are zigzag encoded, so any order would still round-trip.
+ * Entries are grouped in blocks of BlockSize; each block starts at a
+ * checkpoint (where its bytes start and absolute instruction number), so
+ * decoding can start at any block.  Typical dependences take 3 bytes.
+ *
+ * The bytes go into fixed chunks that never move and a block never spans
+ * two chunks.  The number of dependences is published with a release store
+ * after each append, so other threads can read everything below it (see
+ * Snapshot) while one thread keeps appending, without locks on either side.
+ */
+class DependenceStore {
+ public:
+  // Number of dependences per block
+  static const size_t BlockSize = 128;
+
+  /* The first size() dependences of a store at the time the snapshot was
+   * taken.  It does not change while the store is appended to and may be
+   * used from any thread.
+   */
+  class Snapshot {
+   public:
+    // Returns the number of dependences in the snapshot
+    size_t size() const { return myCount; };
+
+    // Calls f(const Dependence &) for dependences [first, last), in order
+    template<class F>
+    void forEach(size_t first, size_t last, F f) const
+      { myStore->forEach(first, last < myCount ? last : myCount, f); };
+
+   private:
+    friend class DependenceStore;
+    Snapshot(const DependenceStore *store, size_t count)
+      : myStore(store), myCount(count) {};
+
+    const DependenceStore *myStore;
+    size_t myCount;
+  };
+
+  // Creates an empty store
+  DependenceStore();
+
+  // Frees the chunks
+  ~DependenceStore();
+
+  // Appends d.  Only one thread may append.
+  void append(const Dependence &d);
+
+  // Returns the number of dependences stored (published)
+  size_t size() const { return myCount.load(memory_order_acquire); };
+
+  // Returns a snapshot of the dependences stored so far
+  Snapshot snapshot() const { return Snapshot(this, size()); };
+
+  // Returns the number of bytes used by the encoded dependences
+  size_t memoryUsage() const
+    { return myChunks.size() * ChunkBytes + myBlocks.memoryUsage(); };
+
+  // Removes every dependence.  No other thread may be reading.
+  void clear();
+
+  // Calls f(const Dependence &) for dependences [first, last), in order
+  template<class F>
+  void forEach(size_t first, size_t last, F f) const;
+
+  // Appends every dependence to out in the encoding above, as one stream
+  // without blocks, starting from second instruction 0
+  void encode(string &out) const;
+
+  // Calls f(const Dependence &) for every dependence, in order
+  template<class F>
+  void forEach(F f) const { forEach(0, size(), f); };
+
+  // A stream written by encode, read in place (see below)
+  class Encoded;
+
+ private:
+  // Bytes per chunk, and the most one block can take
+  static const size_t ChunkBytes = 1 << 16;
+  static const size_t MaxBlockBytes = BlockSize * 21;
+
+  // Where a block starts
+  struct Checkpoint {
+    const uint8_t *start;  // its first entry
+    int64_t current;       // second instruction of the entry before it
+  };
+
+  ChunkedArray<Checkpoint> myBlocks;
+  vector<uint8_t *> myChunks;     // for the writer only
+  uint8_t *myEnd;                 // free space of the last chunk
+  uint8_t *myLimit;
+  atomic<size_t> myCount;
+  int64_t myLastCurrent;
+
+  // Writes v as a zigzag varint at p and returns the byte after it
+  static uint8_t *putVarint(uint8_t *p, int64_t v);
+
+  // Decodes a zigzag varint at p and advances p
+  static int64_t getVarint(const uint8_t *&p);
+
+  // Calls f(const Dependence &) for dependences [first, last) of the
+  // blocks starting at blocks[0], [1], ...; last must be within them
+  template<class Blocks, class F>
+  static void forEachIn(const Blocks &blocks, size_t first, size_t last, F f);
+
+  DependenceStore(const DependenceStore &);
+  DependenceStore &operator=(const DependenceStore &);
+};
+
+
+/* A stream written by DependenceStore::encode, read where it lies: one pass
+ * over the bytes finds the start of every BlockSize dependences, after
+ * which any range of them can be decoded, from any thread, without copying
+ * the stream into a store.
+ */
+class DependenceStore::Encoded {
+ public:
+  // Indexes the stream [p, end), which must outlive this
+  Encoded(const uint8_t *p, const uint8_t *end);
+
+  // Returns false if the stream ends in the middle of a dependence
+  bool isComplete() const { return myComplete; };
+
+  // Returns the number of (whole) dependences in the stream
+  size_t size() const { return myCount; };
+
+  // Calls f(const Dependence &) for dependences [first, last), in order
+  template<class F>
+  void forEach(size_t first, size_t last, F f) const
+    { forEachIn(myBlocks, first, last < myCount ? last : myCount, f); };
+
+ private:
+  vector<Checkpoint> myBlocks;
+  size_t myCount;
+  bool myComplete;
+};
+
+
+inline int64_t DependenceStore::getVarint(const uint8_t *&p)
+  // Decodes a zigzag varint at p and advances p
+{
+  uint64_t u = *p++;
+  if(u & 0x80){
+    u &= 0x7f;
+    int shift = 7;
+    uint8_t b;
+    do{
+      b = *p++;
+      u |= (uint64_t)(b & 0x7f) << shift;
+      shift += 7;
+    } while(b & 0x80);
+  }
+  return (int64_t)(u >> 1) ^ -(int64_t)(u & 1);
+}
+
+inline uint8_t *DependenceStore::putVarint(uint8_t *p, int64_t v)
+  // Writes v as a zigzag varint at p and returns the byte after it
+{
+  uint64_t u = ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+  while(u >= 0x80){
+    *p++ = (uint8_t)(u | 0x80);
+    u >>= 7;
+  }
+  *p++ = (uint8_t)u;
+  return p;
+}
+
+template<class F>
+void DependenceStore::forEach(size_t first, size_t last, F f) const
+  // Calls f(const Dependence &) for dependences [first, last), in order
+{
+  size_t count = size();
+  forEachIn(myBlocks, first, last < count ? last : count, f);
+}
+
+template<class Blocks, class F>
+void DependenceStore::forEachIn(const Blocks &blocks, size_t first, size_t last, F f)
+  // Calls f(const Dependence &) for dependences [first, last) of the
+  // blocks starting at blocks[0], [1], ...; last must be within them
+{
+  if(first >= last)
+    return;
+
+  const uint8_t *p = NULL;
+  int64_t current = 0;
+
+  Dependence d;
+  for(size_t k = first / BlockSize * BlockSize; k < last; k++){
+    // blocks can be in different chunks, so each is found by its checkpoint
+    if(k % BlockSize == 0){
+      p = blocks[k / BlockSize].start;
+      current = blocks[k / BlockSize].current;
+    }
+    current += getVarint(p);
+    uint8_t typeReg = *p++;
+    int64_t distance = getVarint(p);
+    if(k < first)
+      continue;
+    d.dependenceType = (DependenceType)(typeReg >> 6);
+    d.registerNumber = typeReg & 0x3f;
+    d.currentInstructionNumber = current;
+    d.previousInstructionNumber = current - distance;
+    f(d);
+  }
+}
+
+#endif
@@ -1,72 +1,223 @@
 #include "DependencyChecker.h"
+#include "ReportWriter.h"
+#include "PerfCounters.h"
 
 DependencyChecker::DependencyChecker(int numRegisters)
-/* Creates RegisterInfo entries for each of the 32 registers and creates lists for
- * dependencies and instructions.
+/* Creates RegisterInfo entries for each of the 32 registers and an empty list
+ * of dependences.
  */
 {
   RegisterInfo r;
+  myInstructionCount = 0;
+  myPublishedCount = 0;
+  myCurrentOpcode = UNDEFINED;
+  myListener = NULL;
+  myKeepDependences = true;
+  myRecording = NULL;
+  myWindowStart = 0;
 
   // Create entries for all registers
   for(int i = 0; i < numRegisters; i++){
     myCurrentState.insert(make_pair(i, r));
   }
+  for(int i = 0; i < NumRegisters; i++)
+    myStateOf[i] = &myCurrentState[i];
 }
 
-void DependencyChecker::addInstruction(Instruction i)
-/* Adds an instruction to the list of instructions and checks to see if that 
- * instruction results in any new data dependencies.  If new data dependencies
- * are created with the addition of this instruction, appropriate entries
- * are added to the list of dependences.
+void DependencyChecker::addInstruction(const Instruction &i)
+/* Numbers the next instruction and checks to see if that instruction results
+ * in any new data dependencies.  If new data dependencies are created with
+ * the addition of this instruction, appropriate entries are added to the
+ * list of dependences.  The instruction's text is not kept (see
+ * InstructionLog).
  */
 {
-  InstType iType = i.getInstType();
-  unsigned int  rs, rt, rd;
-  rs = rt = rd = -1;
+  PerfScope scope(PERF_CHECK);
   Opcode o = i.getOpcode();
-  switch(iType){
-  
-  case RTYPE:
-    // get register fields for the R-type instruction
-    rs = i.getRS();
-    rt = i.getRT();
-    rd = i.getRD();
-    
-    // check if the R-type instruction has registers rs, rd, rt    
-    if(myOpcodeTable.RSposition(o) != -1) {   
-        checkForReadDependence(rs);
-    }
-    if(myOpcodeTable.RTposition(o) != -1) {
-        checkForReadDependence(rt);
+  myCurrentOpcode = o;
+  if(o >= 0 && o < UNDEFINED){
+    (this->*registerChecks[o])(i);
+  }
+
+  if(myListener)
+    myListener->instructionAdded(i);
+  myInstructionCount++;
+  myPublishedCount.store(myInstructionCount, memory_order_release);
+}
+
+void DependencyChecker::saveState(vector<RegisterInfo> &registers) const
+  // Copies the register table (one entry per register) into registers
+{
+  registers.clear();
+  for(auto &r : myCurrentState)
+    registers.push_back(r.second);
+}
+
+void DependencyChecker::restoreState(int numInstructions, const vector<RegisterInfo> &registers)
+/* Continues from a state saved by saveState after numInstructions
+ * instructions: the next instruction added is numbered numInstructions.
+ * Dependences found before are not restored.
+ */
+{
+  unsigned int reg = 0;
+  for(auto &r : myCurrentState)
+    if(reg < registers.size())
+      r.second = registers[reg++];
+  myInstructionCount = numInstructions;
+  myPublishedCount.store(myInstructionCount, memory_order_release);
+}
+
+void DependencyChecker::addInstructions(const Instruction *i, size_t n)
+/* Adds the n instructions at i, with the same results as n calls to
+ * addInstruction.  The instructions are checked in windows that end at
+ * each j (and are at most MaxWindow long).  The dependences of a window
+ * are remembered by the window's opcodes and registers, so a window seen
+ * before is not checked again: its internal dependences are replayed,
+ * shifted to the current instruction numbers, and only its first access
+ * to each register is checked against the register table.
+ */
+{
+  PerfScope scope(PERF_CHECK);
+  size_t start = 0;
+  while(start < n){
+    size_t end = start;
+    while(end < n && end - start < MaxWindow){
+      end++;
+      if(i[end - 1].getOpcode() == J)
+	break;
     }
-    if(myOpcodeTable.RDposition(o) != -1) { 
-        checkForWriteDependence(rd);
+    addWindow(i + start, end - start);
+    start = end;
+  }
+}
+
+void DependencyChecker::addWindow(const Instruction *i, size_t n)
+  // Checks the n instructions at i as one window
+{
+  myWindowKey.resize(4 * n);
+  for(size_t k = 0; k < n; k++){
+    myWindowKey[4 * k] = i[k].getOpcode();
+    myWindowKey[4 * k + 1] = i[k].getRS();
+    myWindowKey[4 * k + 2] = i[k].getRT();
+    myWindowKey[4 * k + 3] = i[k].getRD();
+  }
+
+  unordered_map<string, WindowPattern>::iterator it = myWindows.find(myWindowKey);
+  if(it != myWindows.end()){
+    replayWindow(it->second, i, n);
+    return;
+  }
+
+  // check the window normally, remembering what happens if there is room
+  if(myWindows.size() < MaxWindows){
+    myRecording = &myWindows[myWindowKey];
+    myWindowStart = myInstructionCount;
+  }
+  for(size_t k = 0; k < n; k++)
+    addInstruction(i[k]);
+  if(myRecording){
+    for(int r = 0; r < NumRegisters; r++){
+      const RegisterInfo &info = myCurrentState.at(r);
+      if(info.lastInstructionToAccess >= myWindowStart){
+	WindowEvent e;
+	e.reg = r;
+	e.boundary = false;
+	e.type = info.accessType;
+	e.previous = e.current = info.lastInstructionToAccess - myWindowStart;
+	myRecording->exits.push_back(e);
+      }
     }
+    myRecording = NULL;
+  }
+}
+
+void DependencyChecker::recordAccess(unsigned int reg, AccessType type)
+  // Records the access to reg by the current instruction in myRecording
+{
+  // later accesses in the window are covered by the dependences recorded
+  // in addDependEntry
+  if(myCurrentState.at(reg).lastInstructionToAccess >= myWindowStart)
+    return;
+
+  WindowEvent e;
+  e.reg = reg;
+  e.boundary = true;
+  e.type = type;
+  e.previous = e.current = myInstructionCount - myWindowStart;
+  myRecording->events.push_back(e);
+}
 
-    break;
-  //get register fields for the I-type instruction
-  case ITYPE:
-    rs = i.getRS();
-    rt = i.getRT();
+void DependencyChecker::replayWindow(const WindowPattern &p, const Instruction *i, size_t n)
+  // Repeats the checks of pattern p for the n instructions at i
+{
+  int base = myInstructionCount;
+  size_t added = 0;      // instructions passed to the listener
+
+  for(const WindowEvent &e : p.events){
+    if(myListener)
+      for(; added < e.current; added++)
+	myListener->instructionAdded(i[added]);
+    myInstructionCount = base + e.current;
+    myCurrentOpcode = i[e.current].getOpcode();
 
-    //check if the I-type instruction contains an immediate field
-    if(i.getImmediate() != -1){
-        checkForReadDependence(rs);
-        checkForWriteDependence(rt);
+    if(e.boundary){
+      AccessType last = myStateOf[e.reg]->accessType;
+      if(e.type == READ && last == WRITE)
+	addDependEntry(e.reg, RAW);
+      else if(e.type == WRITE && last == WRITE)
+	addDependEntry(e.reg, WAW);
+      else if(e.type == WRITE && last == READ)
+	addDependEntry(e.reg, WAR);
     }
-    break;
+    else{
+      Dependence dep;
+      dep.dependenceType = (DependenceType)e.type;
+      dep.registerNumber = e.reg;
+      dep.previousInstructionNumber = base + e.previous;
+      dep.currentInstructionNumber = base + e.current;
+      emitDependence(dep);
+    }
+  }
+  if(myListener)
+    for(; added < n; added++)
+      myListener->instructionAdded(i[added]);
 
-  case JTYPE:
-    break;//J type instructions do not have registers
-  default:
-    // do nothing
-    break;
+  for(const WindowEvent &e : p.exits){
+    RegisterInfo &info = *myStateOf[e.reg];
+    info.lastInstructionToAccess = base + e.current;
+    info.accessType = (AccessType)e.type;
   }
-  // add the instruction to the list
-  myInstructions.push_back(i);
+  myInstructionCount = base + n;
+  myPublishedCount.store(myInstructionCount, memory_order_release);
+}
 
+template<Opcode O>
+void DependencyChecker::checkRegisters(const Instruction &i)
+/* Register read/write checking specialized for opcode O.  Which fields are
+ * read and written is resolved at compile time from OpcodeInfoTable.
+ */
+{
+  // all reads of an instruction happen before its write
+  if constexpr (readsRS(O)) {
+    checkForReadDependence(i.getRS());
+  }
+  if constexpr (readsRT(O)) {
+    checkForReadDependence(i.getRT());
+  }
+  if constexpr (writesRD(O)) {
+    checkForWriteDependence(i.getRD());
+  }
+  if constexpr (writesRT(O)) {
+    checkForWriteDependence(i.getRT());
+  }
 }
 
+const DependencyChecker::RegisterCheck DependencyChecker::registerChecks[UNDEFINED] = {
+#define OPCODE_CHECK(op, ...) &DependencyChecker::checkRegisters<op>,
+  OPCODE_LIST(OPCODE_CHECK)
+#undef OPCODE_CHECK
+};
+
 void DependencyChecker::checkForReadDependence(unsigned int reg)
   /* Determines if a read data dependence occurs when reg is read by the current
    * instruction.  If so, adds an entry to the list of dependences. Also updates
@@ -75,7 +226,9 @@ void DependencyChecker::checkForReadDependence(unsigned int reg)
 { 
    // check if the register is valid
    if(reg >= 0 && reg < NumRegisters){
-       int i = myInstructions.size();
+       int i = myInstructionCount;
+       if(myRecording)
+	 recordAccess(reg, READ);
            // check for the previous access type to determine if it is a RAW dependence               
 	   if(myCurrentState[reg].accessType == WRITE) {
                 addDependEntry(reg, RAW);
@@ -98,8 +251,27 @@ void DependencyChecker::addDependEntry(unsigned int reg, DependenceType type)
     dep.dependenceType = type;
     dep.registerNumber = reg;
     dep.previousInstructionNumber = myCurrentState.at(reg).lastInstructionToAccess;
-    dep.currentInstructionNumber = myInstructions.size() ;
-    myDependences.push_back(dep);
+    dep.currentInstructionNumber = myInstructionCount;
+    if(myRecording && dep.previousInstructionNumber >= myWindowStart){
+      // a dependence inside the window being recorded
+      WindowEvent e;
+      e.reg = reg;
+      e.boundary = false;
+      e.type = type;
+      e.previous = dep.previousInstructionNumber - myWindowStart;
+      e.current = myInstructionCount - myWindowStart;
+      myRecording->events.push_back(e);
+    }
+    emitDependence(dep);
+}
+
+void DependencyChecker::emitDependence(const Dependence &d)
+  // Stores d and passes it to the listener
+{
+  if(myListener)
+    myListener->dependenceFound(d, myCurrentOpcode);
+  if(myKeepDependences)
+    myDependences.append(d);
 }
 
 
@@ -112,7 +284,9 @@ void DependencyChecker::checkForWriteDependence(unsigned int reg)
 {
    // check if the register is valid
    if(reg >= 0 && reg < NumRegisters){
-      int i = myInstructions.size();
+      int i = myInstructionCount;
+      if(myRecording)
+	recordAccess(reg, WRITE);
       //check for the previous access type to determine if it is a WAW or WAR dependency
       if(myCurrentState[reg].accessType == WRITE) {
          addDependEntry(reg,WAW);
@@ -130,42 +304,76 @@ void DependencyChecker::checkForWriteDependence(unsigned int reg)
 }
 
 
-void DependencyChecker::printDependences()
-  /* Prints out the sequence of instructions followed by the sequence of data
-   * dependencies.
+bool DependencyChecker::printDependences(const InstructionLog &log, int numThreads)
+  /* Prints out the sequence of instructions held by log followed by the
+   * sequence of data dependencies.  The text is formatted in parallel on
+   * numThreads threads (0: one per hardware thread) and written to standard
+   * output in order.  Returns false if it could not be written.
    */ 
 {
+  return printReport(log, myDependences, numThreads);
+}
+
+bool DependencyChecker::printReport(const InstructionLog &log,
+				    const DependenceStore &dependences, int numThreads)
+  // Prints the report of printDependences for the given dependences
+{
+  PerfScope scope(PERF_OUTPUT);
+  cout.flush();
+  ReportWriter writer(1, numThreads);
+
   // First, print all instructions
-  list<Instruction>::iterator liter;
-  int i = 0;
-  cout << "INSTRUCTIONS:" << endl;
-  for(liter = myInstructions.begin(); liter != myInstructions.end(); liter++){
-    cout << i << ": " << (*liter).getAssembly() << endl;
-    i++;
-  }
+  writer.write("INSTRUCTIONS:\n");
+  size_t first = log.first();
+  writer.writeRecords(log.size() - first, [&log, first](size_t from, size_t to, string &out){
+      log.forEach(first + from, first + to, [&out](size_t k, const char *text, size_t length){
+	  formatInstruction(out, k, text, length);
+	});
+    });
 
   // Second, print all dependences
-  list<Dependence>::iterator diter;
-  cout << "DEPENDENCES: \nType Register (FirstInstr#, SecondInstr#) " << endl;
-  for(diter = myDependences.begin(); diter != myDependences.end(); diter++){
-    switch( (*diter).dependenceType){
-    case RAW:
-      cout << "RAW \t";
-      break;
-    case WAR:
-      cout << "WAR \t";
-      break;
-    case WAW:
-      cout << "WAW \t";
-      break;
-    default:
-      break;
-    }
+  writer.write("DEPENDENCES: \nType Register (FirstInstr#, SecondInstr#) \n");
+  writer.writeRecords(dependences.size(), [&dependences](size_t first, size_t last, string &out){
+      dependences.forEach(first, last, [&out](const Dependence &d){
+	  formatDependence(out, d);
+	});
+    });
+  return !writer.hasError();
+}
 
-    cout << "$" << (*diter).registerNumber << " \t";
-    cout << "(" << (*diter).previousInstructionNumber << ", ";
-    cout << (*diter).currentInstructionNumber << ")" << endl;
+void DependencyChecker::printDependence(ostream &out, const Dependence &d)
+  /* Prints one dependence in the format used by printDependences, e.g.
+   * "RAW \t$3 \t(1, 3)".
+   */
+{
+  string s;
+  formatDependence(s, d);
+  out << s;
+}
+
+void DependencyChecker::formatDependence(string &out, const Dependence &d)
+  // Appends the report line of a dependence to out
+{
+  if(d.dependenceType < D_UNDEFINED){
+    out += DependenceTypeName[d.dependenceType];
+    out += " \t";
   }
 
+  out += '$';
+  ReportWriter::appendNumber(out, d.registerNumber);
+  out += " \t(";
+  ReportWriter::appendNumber(out, d.previousInstructionNumber);
+  out += ", ";
+  ReportWriter::appendNumber(out, d.currentInstructionNumber);
+  out += ")\n";
+}
 
+void DependencyChecker::formatInstruction(string &out, long k,
+					  const char *assembly, size_t length)
+  // Appends the report line of instruction number k to out
+{
+  ReportWriter::appendNumber(out, k);
+  out += ": ";
+  out.append(assembly, length);
+  out += '\n';
 }
@@ -3,12 +3,20 @@
 
 #include <iostream>
 #include <map>
-#include <list>
+#include <unordered_map>
+#include <atomic>
+#include <vector>
+#include <string>
+#include <stdint.h>
 
 using namespace std;
 
 #include "Instruction.h"
 #include "OpcodeTable.h"
+#include "Dependence.h"
+#include "DependenceStore.h"
+#include "InstructionLog.h"
+#include "DependenceStats.h"
 
 /*
  * The DependencyChecker class finds all of the data dependencies (RAW, WAR, WAW)
@@ -16,14 +24,6 @@ using namespace std;
  */
 
 
-// The different types of possible data dependencies. 
-enum DependenceType{
-  RAW,                 // Read After Write
-  WAR,                 // Write After Read
-  WAW,                 // Write After Write
-  D_UNDEFINED
-};
-
 // The different ways of accessing data
 enum AccessType{
   READ,
@@ -46,41 +46,94 @@ struct RegisterInfo{
   };
 };
 
-/* The Dependence struct keeps track of the involved instructions, the register
- * that the dependence involves, and what type of dependence.
- */
-struct Dependence {
-  DependenceType dependenceType;        
-  unsigned int registerNumber;
-  int previousInstructionNumber;         // first instruction to occur
-  int currentInstructionNumber;          // second instruction to occur  
-};
-
-
 /* This class keeps track of a sequence of instructions and determines data
  * dependencies that occur between the instructions due to register usage.  Instructions
  * are numbered and those numbers are used to keep track of which instructions
- * are used in a dependence.
+ * are used in a dependence.  The analysis state is only the register table and
+ * the instruction counter; the text of the instructions, needed for the
+ * report, is kept by an InstructionLog.
  */ 
 class DependencyChecker {
  public:
 
-  /* Creates RegisterInfo entries for each of the 32 registers and creates lists for
-   * dependencies and instructions.
+  /* Creates RegisterInfo entries for each of the 32 registers and an empty list
+   * of dependences.
    */
   DependencyChecker(int numRegisters = 32);
   
-  /* Adds an instruction to the list of instructions and checks to see if that 
-   * instruction results in any new data dependencies.  If new data dependencies
-   * are created with the addition of this instruction, appropriate entries
-   * are added to the list of dependences.
+  /* Numbers the next instruction and checks to see if that instruction results
+   * in any new data dependencies.  If new data dependencies are created with
+   * the addition of this instruction, appropriate entries are added to the
+   * list of dependences.  The instruction's text is not kept (see
+   * InstructionLog).
+   */
+  void addInstruction(const Instruction &i);
+
+  /* Adds the n instructions at i, with the same results as n calls to
+   * addInstruction.  The instructions are checked in windows that end at
+   * each j (and are at most MaxWindow long).  The dependences of a window
+   * are remembered by the window's opcodes and registers, so a window seen
+   * before is not checked again: its internal dependences are replayed,
+   * shifted to the current instruction numbers, and only its first access
+   * to each register is checked against the register table.
    */
-  void addInstruction(Instruction i);
+  void addInstructions(const Instruction *i, size_t n);
 
-  /* Prints out the sequence of instructions followed by the sequence of data
-   * dependencies.
+  /* Prints out the sequence of instructions held by log followed by the
+   * sequence of data dependencies.  The text is formatted in parallel on
+   * numThreads threads (0: one per hardware thread) and written to standard
+   * output in order.  Returns false if it could not be written.
    */ 
-  void printDependences();
+  bool printDependences(const InstructionLog &log, int numThreads = 0);
+
+  // Prints the report of printDependences for the given dependences
+  static bool printReport(const InstructionLog &log, const DependenceStore &dependences,
+			  int numThreads = 0);
+
+  /* Prints one dependence in the format used by printDependences, e.g.
+   * "RAW \t$3 \t(1, 3)".
+   */
+  static void printDependence(ostream &out, const Dependence &d);
+
+  // Appends the report line of a dependence to out
+  static void formatDependence(string &out, const Dependence &d);
+
+  // Appends the report line of instruction number k to out
+  static void formatInstruction(string &out, long k, const char *assembly, size_t length);
+
+  /* Sends every dependence found from now on, and every instruction added,
+   * to listener (NULL for none).  If keepDependences is false the dependences
+   * are not stored, so memory does not grow with the number of dependences.
+   */
+  void setListener(DependenceListener *listener, bool keepDependences = true)
+    { myListener = listener; myKeepDependences = keepDependences; };
+
+  // Returns the number of instructions added so far.  May be called from
+  // any thread while instructions are being added.
+  int numInstructions() const { return myPublishedCount.load(memory_order_acquire); };
+
+  // Copies the register table (one entry per register) into registers
+  void saveState(vector<RegisterInfo> &registers) const;
+
+  /* Continues from a state saved by saveState after numInstructions
+   * instructions: the next instruction added is numbered numInstructions.
+   * Dependences found before are not restored.
+   */
+  void restoreState(int numInstructions, const vector<RegisterInfo> &registers);
+
+  // Returns the number of dependences found so far
+  size_t numDependences() const { return myDependences.size(); };
+
+  // Returns the dependences found so far.  May be called from any thread
+  // while instructions are being added; the snapshot does not change.
+  DependenceStore::Snapshot dependenceSnapshot() const { return myDependences.snapshot(); };
+
+  // Calls f(const Dependence &) for every dependence found, in the order
+  // they were found (ascending second instruction number).
+  template<class F>
+  void forEachDependence(F f) const {
+    myDependences.forEach(f);
+  };
 
  private:
   /* Determines if a read data dependence occurs when reg is read by the current
@@ -94,13 +147,69 @@ class DependencyChecker {
    * the appropriate RegisterInfo entry regardless of dependence detection.
    */
   void checkForWriteDependence(unsigned int reg);
-// add comment
+
+  /* Adds an entry of the given type on register reg between the last instruction
+   * to access reg and the current instruction to the list of dependences.
+   */
   void addDependEntry(unsigned int reg, DependenceType type);
 
+  // Stores d and passes it to the listener
+  void emitDependence(const Dependence &d);
+
+  // Longest window addInstructions remembers, and most windows it keeps
+  static const size_t MaxWindow = 64;
+  static const size_t MaxWindows = 1 << 16;
+
+  /* One step of checking a window, at window offset current: either a
+   * dependence between two of its instructions, or the window's first
+   * access to reg, whose dependence depends on the register table.
+   */
+  struct WindowEvent {
+    uint8_t reg;
+    bool boundary;
+    uint8_t type;             // AccessType if boundary, else DependenceType
+    uint16_t previous;
+    uint16_t current;
+  };
+
+  // What checking a window does, independent of where it is in the program
+  struct WindowPattern {
+    vector<WindowEvent> events;        // in the order the checks happen
+    vector<WindowEvent> exits;         // last access to each register touched
+  };
+
+  // Checks the n instructions at i as one window
+  void addWindow(const Instruction *i, size_t n);
+
+  // Records the access to reg by the current instruction in myRecording
+  void recordAccess(unsigned int reg, AccessType type);
+
+  // Repeats the checks of pattern p for the n instructions at i
+  void replayWindow(const WindowPattern &p, const Instruction *i, size_t n);
+
+  /* Register read/write checking specialized for opcode O.  Which fields are
+   * read and written is resolved at compile time from OpcodeInfoTable.
+   */
+  template<Opcode O>
+  void checkRegisters(const Instruction &i);
+
+  // Jump table of checkRegisters<O>, one entry per Opcode
+  typedef void (DependencyChecker::*RegisterCheck)(const Instruction &i);
+  static const RegisterCheck registerChecks[UNDEFINED];
+
   map<unsigned int, RegisterInfo> myCurrentState;
-  list<Dependence> myDependences;
-  list<Instruction> myInstructions;
-  OpcodeTable myOpcodeTable;
+  RegisterInfo *myStateOf[NumRegisters];   // entries of myCurrentState, for replays
+  DependenceStore myDependences;
+  int myInstructionCount;               // number of the current instruction
+  atomic<int> myPublishedCount;         // instructions completely checked
+  Opcode myCurrentOpcode;               // opcode of the current instruction
+  DependenceListener *myListener;
+  bool myKeepDependences;
+
+  unordered_map<string, WindowPattern> myWindows;   // keyed by packed fields
+  string myWindowKey;
+  WindowPattern *myRecording;           // window being checked, or NULL
+  int myWindowStart;                    // its first instruction
 };
 
 
@@ -0,0 +1,219 @@
+#include "ExternalReport.h"
+#include "DependencyChecker.h"
+#include "ReportWriter.h"
+#include "PerfCounters.h"
+#include <iostream>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Bytes per write to the temporary files
+static const size_t WriteSize = 1 << 20;
+
+// Formats the dependences of store (a DependenceStore or an encoded run)
+// and writes them with writer
+template<class Store>
+static void writeDependences(ReportWriter &writer, const Store &store)
+{
+  writer.writeRecords(store.size(), [&store](size_t first, size_t last, string &out){
+      store.forEach(first, last, [&out](const Dependence &d){
+	  DependencyChecker::formatDependence(out, d);
+	});
+    });
+}
+
+ExternalReport::ExternalReport(size_t budget)
+  // Keeps at most about budget bytes of results in memory
+  : myLog(new InstructionLog)
+{
+  myBudget = budget < MinBudget ? MinBudget : budget;
+  myError = false;
+  myUnchecked = 0;
+  myTextFd = myDependenceFd = -1;
+}
+
+ExternalReport::~ExternalReport()
+  // Closes (and so removes) the temporary files
+{
+  if(myTextFd >= 0)
+    close(myTextFd);
+  if(myDependenceFd >= 0)
+    close(myDependenceFd);
+}
+
+void ExternalReport::dependenceFound(const Dependence &d, Opcode consumer)
+  // DependenceListener: keeps d
+{
+  myDependences.append(d);
+}
+
+void ExternalReport::instructionAdded(const Instruction &i)
+  // DependenceListener: keeps the text of i, and spills if over budget
+{
+  myLog->append(i.getAssembly());
+  if(++myUnchecked < CheckEvery)
+    return;
+  myUnchecked = 0;
+  if(myLog->memoryUsage() + myDependences.memoryUsage() >= myBudget)
+    spill();
+}
+
+void ExternalReport::spill()
+  // Writes the results in memory out as a run and clears them
+{
+  if(myError)
+    return;
+  if(myTextFd < 0){
+    myTextFd = openTemporary();
+    myDependenceFd = openTemporary();
+    if(myTextFd < 0 || myDependenceFd < 0){
+      cerr << "Could not create temporary files: " << strerror(errno) << endl;
+      myError = true;
+      return;
+    }
+  }
+
+  // one line of text per instruction, written in large pieces
+  size_t count = myLog->size();
+  string bytes;
+  beginRun(myTextRuns, count);
+  myLog->forEach(0, count, [&](size_t k, const char *text, size_t length){
+      bytes.append(text, length);
+      bytes += '\n';
+      if(bytes.size() >= WriteSize){
+	if(!appendRun(myTextFd, myTextRuns, bytes))
+	  myError = true;
+	bytes.clear();
+      }
+    });
+  if(!appendRun(myTextFd, myTextRuns, bytes))
+    myError = true;
+
+  bytes.clear();
+  myDependences.encode(bytes);
+  beginRun(myDependenceRuns, myDependences.size());
+  if(!appendRun(myDependenceFd, myDependenceRuns, bytes))
+    myError = true;
+  if(myError)
+    cerr << "Could not write temporary files: " << strerror(errno) << endl;
+
+  myLog.reset(new InstructionLog);
+  myDependences.clear();
+}
+
+void ExternalReport::beginRun(vector<Run> &runs, size_t count)
+  // Starts a run of count records after the last run of runs
+{
+  Run r = { 0, 0, count };
+  if(!runs.empty())
+    r.offset = runs.back().offset + runs.back().bytes;
+  runs.push_back(r);
+}
+
+bool ExternalReport::appendRun(int fd, vector<Run> &runs, const string &bytes)
+  // Appends bytes to the last run of runs, in fd
+{
+  Run &r = runs.back();
+  for(size_t done = 0; done < bytes.size(); ){
+    size_t n = min(WriteSize, bytes.size() - done);
+    ssize_t w = pwrite(fd, bytes.data() + done, n, r.offset + r.bytes);
+    if(w < 0 && errno == EINTR)
+      continue;
+    if(w <= 0)
+      return false;
+    done += w;
+    r.bytes += w;
+  }
+  return true;
+}
+
+bool ExternalReport::readRun(int fd, const Run &r, string &bytes)
+  // Reads run r of fd into bytes
+{
+  bytes.resize(r.bytes);
+  for(size_t done = 0; done < r.bytes; ){
+    ssize_t got = pread(fd, &bytes[done], r.bytes - done, r.offset + done);
+    if(got < 0 && errno == EINTR)
+      continue;
+    if(got <= 0)
+      return false;
+    done += got;
+  }
+  return true;
+}
+
+int ExternalReport::openTemporary()
+  // Opens an anonymous temporary file; returns -1 on error
+{
+  const char *directory = getenv("TMPDIR");
+  string path = string(directory && *directory ? directory : "/tmp") + "/DCHECKER.XXXXXX";
+  int fd = mkstemp(&path[0]);
+  if(fd >= 0)
+    unlink(path.c_str());
+  return fd;
+}
+
+
+bool ExternalReport::print(int numThreads)
+  /* Prints the report, formatted on numThreads threads (0: one per
+   * hardware thread), to standard output.  Returns false if the temporary
+   * files could not be written or read back, or the report not written.
+   */
+{
+  if(myError)
+    return false;
+  PerfScope scope(PERF_OUTPUT);
+  cout.flush();
+  ReportWriter writer(1, numThreads);
+  string bytes;
+
+  // the spilled instructions, one run at a time, then those in memory
+  writer.write("INSTRUCTIONS:\n");
+  size_t base = 0;
+  vector<size_t> lineStart;
+  for(const Run &r : myTextRuns){
+    if(!readRun(myTextFd, r, bytes))
+      return false;
+    // every line ends with a newline
+    lineStart.clear();
+    const char *p = bytes.data(), *end = p + bytes.size();
+    while(p < end){
+      lineStart.push_back(p - bytes.data());
+      const char *nl = (const char *)memchr(p, '\n', end - p);
+      if(nl == NULL)
+	return false;
+      p = nl + 1;
+    }
+    lineStart.push_back(bytes.size());
+    if(lineStart.size() != r.count + 1)
+      return false;
+    writer.writeRecords(r.count, [&](size_t first, size_t last, string &out){
+	for(size_t k = first; k < last; k++)
+	  DependencyChecker::formatInstruction(out, base + k, &bytes[lineStart[k]],
+					       lineStart[k + 1] - lineStart[k] - 1);
+      });
+    base += r.count;
+  }
+  const InstructionLog &log = *myLog;
+  writer.writeRecords(log.size(), [&log, base](size_t first, size_t last, string &out){
+      log.forEach(first, last, [&out, base](size_t k, const char *text, size_t length){
+	  DependencyChecker::formatInstruction(out, base + k, text, length);
+	});
+    });
+
+  // the dependences, the same way
+  writer.write("DEPENDENCES: \nType Register (FirstInstr#, SecondInstr#) \n");
+  for(const Run &r : myDependenceRuns){
+    if(!readRun(myDependenceFd, r, bytes))
+      return false;
+    // formatted where they lie in bytes
+    DependenceStore::Encoded run((const uint8_t *)bytes.data(),
+				 (const uint8_t *)bytes.data() + bytes.size());
+    if(!run.isComplete() || run.size() != r.count)
+      return false;
+    writeDependences(writer, run);
+  }
+  writeDependences(writer, myDependences);
+  return !writer.hasError();
+}
@@ -0,0 +1,95 @@
+#ifndef __EXTERNALREPORT_H__
+#define __EXTERNALREPORT_H__
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+using namespace std;
+
+#include "DependenceStats.h"
+#include "DependenceStore.h"
+#include "InstructionLog.h"
+
+/* Collects the dependence report of a DependencyChecker (as its listener)
+ * within a memory budget.  The instruction text and the dependences are
+ * kept in an InstructionLog and a DependenceStore until together they use
+ * the budget; then both are written out as one run each, with large
+ * sequential writes, to two temporary files (in $TMPDIR, or /tmp, removed
+ * as soon as they are opened), and collection starts over in memory.
+ *
+ * Instructions and dependences arrive in instruction order, so every run
+ * is sorted and follows the run before it: printing reads the runs back one
+ * at a time, in order, and formats each like printDependences does.  The
+ * output is byte for byte that of printDependences, and no more than about
+ * one run is in memory at any time.
+ */
+class ExternalReport : public DependenceListener {
+ public:
+  // Smallest budget used; below it runs would be too short to pay off
+  static const size_t MinBudget = 4 << 20;
+
+  // Keeps at most about budget bytes of results in memory
+  ExternalReport(size_t budget);
+
+  // Closes (and so removes) the temporary files
+  ~ExternalReport();
+
+  // DependenceListener: keeps d
+  void dependenceFound(const Dependence &d, Opcode consumer);
+
+  // DependenceListener: keeps the text of i, and spills if over budget
+  void instructionAdded(const Instruction &i);
+
+  /* Prints the report, formatted on numThreads threads (0: one per
+   * hardware thread), to standard output.  Returns false if the temporary
+   * files could not be written or read back, or the report not written.
+   */
+  bool print(int numThreads = 0);
+
+  // Returns the number of times results were written out
+  size_t numSpills() const { return myTextRuns.size(); };
+
+ private:
+  // Instructions between checks of the memory used
+  static const size_t CheckEvery = 1024;
+
+  // A stretch of a temporary file written at one spill
+  struct Run {
+    off_t offset;
+    size_t bytes;
+    size_t count;          // instructions or dependences in it
+  };
+
+  size_t myBudget;
+  bool myError;
+  size_t myUnchecked;            // instructions added since the last check
+
+  unique_ptr<InstructionLog> myLog;     // instructions since the last spill
+  DependenceStore myDependences;        // dependences since the last spill
+
+  int myTextFd;                  // temporary files, or -1 before the first spill
+  int myDependenceFd;
+  vector<Run> myTextRuns;
+  vector<Run> myDependenceRuns;
+
+  // Writes the results in memory out as a run and clears them
+  void spill();
+
+  // Starts a run of count records after the last run of runs
+  void beginRun(vector<Run> &runs, size_t count);
+
+  // Appends bytes to the last run of runs, in fd
+  bool appendRun(int fd, vector<Run> &runs, const string &bytes);
+
+  // Reads run r of fd into bytes
+  bool readRun(int fd, const Run &r, string &bytes);
+
+  // Opens an anonymous temporary file; returns -1 on error
+  static int openTemporary();
+};
+
+#endif
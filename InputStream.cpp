@@ -0,0 +1,434 @@
+#include "InputStream.h"
+#include <string.h>
+#include <errno.h>
+#include <iostream>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+InputStream::InputStream(string filename, uint64_t start)
+  // Opens filename ("-" for standard input) and starts the reader thread.
+  // The first start (uncompressed) bytes are skipped: seeked over in a
+  // plain file, read and dropped otherwise.
+{
+  myError = false;
+  myReadErrno = 0;
+  myOffset = 0;
+  myPos = 0;
+  myEnd = false;
+  myStop = false;
+  myCompression = PLAIN;
+
+  if(filename == "-"){
+    myFd = 0;
+    myCloseFd = false;
+  }
+  else{
+    myFd = open(filename.c_str(), O_RDONLY);
+    myCloseFd = true;
+  }
+  if(myFd < 0){
+    myEnd = true;
+    return;
+  }
+
+  // Sniff the magic number; the bytes read are replayed by readRaw
+  myHead.resize(4);
+  size_t got = 0;
+  while(got < myHead.size()){
+    ssize_t r = ::read(myFd, &myHead[got], myHead.size() - got);
+    if(r < 0 && errno == EINTR)
+      continue;
+    if(r < 0)
+      myReadErrno = errno;
+    if(r <= 0)
+      break;
+    got += r;
+  }
+  myHead.resize(got);
+
+  const unsigned char *m = (const unsigned char *)myHead.data();
+  if(got >= 2 && m[0] == 0x1f && m[1] == 0x8b)
+    myCompression = GZIP;
+  else if(got >= 4 && m[0] == 0x28 && m[1] == 0xb5 && m[2] == 0x2f && m[3] == 0xfd)
+    myCompression = ZSTD;
+
+  if(start > 0 && myCompression == PLAIN && lseek(myFd, start, SEEK_SET) >= 0){
+    myHead.clear();
+    myOffset = start;
+    start = 0;
+  }
+
+  myReader = thread(&InputStream::readerLoop, this);
+  skip(start);
+}
+
+InputStream::~InputStream()
+  // Stops the reader thread and closes the input
+{
+  {
+    lock_guard<mutex> guard(myLock);
+    myStop = true;
+  }
+  myDrained.notify_all();
+  if(myReader.joinable())
+    myReader.join();
+  if(myCloseFd && myFd >= 0)
+    close(myFd);
+}
+
+
+bool InputStream::getLine(string &line)
+  // Reads the next line, without its newline, into line.  Returns false at
+  // the end of the input.
+{
+  const char *text;
+  size_t length, readable;
+  if(!getLine(text, length, readable)){
+    line.clear();
+    return false;
+  }
+  line.assign(text, length);
+  return true;
+}
+
+bool InputStream::getLine(const char *&text, size_t &length, size_t &readable)
+  // Points text at the next line, without its newline, and sets length to
+  // its length.  The line is left in place in the input buffer when it can
+  // be, and stays valid until the next call; readable is set to the number
+  // of bytes (at least length) that may be read from text on.  Returns
+  // false at the end of the input.
+{
+  if(myPos == myCurrent.size() && !nextBuffer())
+    return false;
+
+  const char *start = myCurrent.data() + myPos;
+  size_t avail = myCurrent.size() - myPos;
+  const char *nl = (const char *)memchr(start, '\n', avail);
+  if(nl != NULL){
+    text = start;
+    length = nl - start;
+    readable = avail;
+    myPos += length + 1;
+    myOffset += length + 1;
+    return true;
+  }
+
+  // the line continues in the next buffer(s)
+  myLine.assign(start, avail);
+  myPos += avail;
+  myOffset += avail;
+  while(myPos < myCurrent.size() || nextBuffer()){
+    start = myCurrent.data() + myPos;
+    avail = myCurrent.size() - myPos;
+    nl = (const char *)memchr(start, '\n', avail);
+    size_t len = nl != NULL ? nl - start : avail;
+    myLine.append(start, len);
+    myPos += len;
+    myOffset += len;
+    if(nl != NULL){
+      myPos++;
+      myOffset++;
+      break;
+    }
+  }
+  text = myLine.data();
+  length = readable = myLine.size();
+  return true;
+}
+
+size_t InputStream::read(char *buf, size_t n)
+  // Reads up to n bytes into buf.  Returns the number of bytes read, which is
+  // less than n only at the end of the input.
+{
+  size_t done = 0;
+  while(done < n){
+    if(myPos == myCurrent.size() && !nextBuffer())
+      break;
+    size_t k = min(n - done, myCurrent.size() - myPos);
+    memcpy(buf + done, myCurrent.data() + myPos, k);
+    myPos += k;
+    done += k;
+  }
+  myOffset += done;
+  return done;
+}
+
+uint64_t InputStream::skip(uint64_t n)
+  // Drops the next n bytes.  Returns the number dropped, less than n only
+  // at the end of the input.
+{
+  uint64_t done = 0;
+  while(done < n){
+    if(myPos == myCurrent.size() && !nextBuffer())
+      break;
+    size_t k = min(n - done, (uint64_t)(myCurrent.size() - myPos));
+    myPos += k;
+    done += k;
+  }
+  myOffset += done;
+  return done;
+}
+
+
+bool InputStream::nextBuffer()
+  // Makes myCurrent the next queued buffer.  Returns false at the end.
+{
+  unique_lock<mutex> guard(myLock);
+  if(myCurrent.capacity() != 0)
+    myFree.push_back(move(myCurrent));
+  myCurrent.clear();
+  myPos = 0;
+
+  myFilled.wait(guard, [this]{ return !myFull.empty() || myEnd; });
+  if(myFull.empty())
+    return false;
+  myCurrent = move(myFull.front());
+  myFull.pop_front();
+  guard.unlock();
+  myDrained.notify_one();
+  return true;
+}
+
+vector<char> InputStream::getFreeBuffer()
+  // Returns an empty buffer of BufferSize bytes to fill
+{
+  vector<char> buf;
+  {
+    lock_guard<mutex> guard(myLock);
+    if(!myFree.empty()){
+      buf = move(myFree.back());
+      myFree.pop_back();
+    }
+  }
+  buf.resize(BufferSize);
+  return buf;
+}
+
+bool InputStream::putBuffer(vector<char> &buf)
+  // Queues buf (resized to its used length) for the caller.  Returns false
+  // if the caller has stopped reading.
+{
+  unique_lock<mutex> guard(myLock);
+  myDrained.wait(guard, [this]{ return myFull.size() < QueueDepth || myStop; });
+  if(myStop)
+    return false;
+  myFull.push_back(move(buf));
+  guard.unlock();
+  myFilled.notify_one();
+  return true;
+}
+
+
+void InputStream::readerLoop()
+  // Body of the reader thread: reads, decompresses and queues buffers
+{
+  bool ok;
+  switch(myCompression){
+  case GZIP:
+    ok = inflateGzip();
+    break;
+  case ZSTD:
+    ok = inflateZstd();
+    break;
+  default:
+    ok = copyPlain();
+    break;
+  }
+
+  if(myReadErrno != 0){
+    cerr << "Could not read input: " << strerror(myReadErrno) << endl;
+    ok = false;
+  }
+
+  {
+    lock_guard<mutex> guard(myLock);
+    if(!ok)
+      myError = true;
+    myEnd = true;
+  }
+  myFilled.notify_all();
+}
+
+size_t InputStream::readRaw(char *buf, size_t n)
+  // Reads raw bytes from the input, starting with myHead.  Returns the
+  // number of bytes read, 0 at the end of the input, on an error (which
+  // is kept in myReadErrno) or once the caller has stopped reading.
+{
+  if(myReadErrno != 0)
+    return 0;
+  if(!myHead.empty()){
+    size_t k = min(n, myHead.size());
+    memcpy(buf, myHead.data(), k);
+    myHead.erase(myHead.begin(), myHead.begin() + k);
+    return k;
+  }
+  while(true){
+    // Wait for data in short slices so that a stalled pipe or terminal
+    // cannot keep the destructor from joining this thread
+    struct pollfd p = { myFd, POLLIN, 0 };
+    int ready = poll(&p, 1, 100);
+    if(myStop)
+      return 0;
+    if(ready == 0 || (ready < 0 && errno == EINTR))
+      continue;
+    ssize_t r = ::read(myFd, buf, n);
+    if(r >= 0)
+      return r;
+    if(errno != EINTR){
+      myReadErrno = errno;
+      return 0;
+    }
+  }
+}
+
+bool InputStream::rawReady()
+  // Returns true if readRaw has input to return within a few milliseconds
+{
+  if(!myHead.empty() || myReadErrno != 0)
+    return true;
+  struct pollfd p = { myFd, POLLIN, 0 };
+  return poll(&p, 1, 10) != 0;
+}
+
+bool InputStream::copyPlain()
+  // Queues the input unchanged, one full buffer at a time, or what has
+  // arrived so far when a pipe or terminal has nothing more to give
+{
+  while(true){
+    vector<char> buf = getFreeBuffer();
+    size_t used = 0;
+    size_t r = 1;
+    while(used < buf.size() && (r = readRaw(&buf[used], buf.size() - used)) > 0){
+      used += r;
+      if(!rawReady())
+	break;
+    }
+    buf.resize(used);
+    if(used > 0 && !putBuffer(buf))
+      return true;
+    if(r == 0)
+      return true;
+  }
+}
+
+bool InputStream::inflateGzip()
+  // Decompresses gzip input (including concatenated members) into buffers
+{
+  z_stream z;
+  memset(&z, 0, sizeof(z));
+  if(inflateInit2(&z, 15 + 32) != Z_OK)   // 32: detect the gzip header
+    return false;
+
+  vector<char> in(BufferSize);
+  vector<char> out = getFreeBuffer();
+  size_t used = 0;
+  bool ok = true;
+  bool eof = false;
+  bool midMember = false;    // a gzip member has started but not ended
+
+  while(ok){
+    if(z.avail_in == 0 && !eof){
+      size_t r = readRaw(&in[0], in.size());
+      if(r == 0)
+	eof = true;
+      z.next_in = (Bytef *)&in[0];
+      z.avail_in = r;
+    }
+    if(z.avail_in == 0 && eof)
+      break;
+    midMember = true;
+
+    z.next_out = (Bytef *)&out[used];
+    z.avail_out = out.size() - used;
+    int ret = inflate(&z, Z_NO_FLUSH);
+    used = out.size() - z.avail_out;
+
+    if(ret == Z_STREAM_END){
+      // another gzip member may follow
+      midMember = false;
+      if(inflateReset(&z) != Z_OK)
+	ok = false;
+    }
+    else if(ret != Z_OK && ret != Z_BUF_ERROR)
+      ok = false;
+
+    if(used == out.size()){
+      if(!putBuffer(out))
+	break;
+      out = getFreeBuffer();
+      used = 0;
+    }
+  }
+
+  if(midMember)
+    ok = false;     // truncated input
+  out.resize(used);
+  if(used > 0)
+    putBuffer(out);
+  inflateEnd(&z);
+  return ok;
+}
+
+bool InputStream::inflateZstd()
+  // Decompresses zstd input into buffers
+{
+#ifdef HAVE_ZSTD
+  ZSTD_DStream *ds = ZSTD_createDStream();
+  if(ds == NULL)
+    return false;
+  ZSTD_initDStream(ds);
+
+  vector<char> in(ZSTD_DStreamInSize());
+  vector<char> out = getFreeBuffer();
+  ZSTD_inBuffer zin = { &in[0], 0, 0 };
+  ZSTD_outBuffer zout = { &out[0], out.size(), 0 };
+  bool ok = true;
+  bool eof = false;
+  size_t ret = 1;            // 0 once a frame is complete and flushed
+
+  while(true){
+    if(zin.pos == zin.size && !eof){
+      size_t r = readRaw(&in[0], in.size());
+      if(r == 0)
+	eof = true;
+      zin.size = r;
+      zin.pos = 0;
+    }
+    // with the input used up, keep flushing until the last frame is done
+    if(eof && ret == 0)
+      break;
+    size_t before = zout.pos;
+    ret = ZSTD_decompressStream(ds, &zout, &zin);
+    if(ZSTD_isError(ret)){
+      ok = false;
+      break;
+    }
+    if(zout.pos == zout.size){
+      if(!putBuffer(out))
+	break;
+      out = getFreeBuffer();
+      zout.dst = &out[0];
+      zout.size = out.size();
+      zout.pos = 0;
+    }
+    else if(eof && ret != 0 && zout.pos == before){
+      ok = false;     // truncated frame
+      break;
+    }
+  }
+
+  out.resize(zout.pos);
+  if(zout.pos > 0)
+    putBuffer(out);
+  ZSTD_freeDStream(ds);
+  return ok;
+#else
+  cerr << "DCHECKER was built without zstd support" << endl;
+  return false;
+#endif
+}
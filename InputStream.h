@@ -0,0 +1,118 @@
+#ifndef __INPUTSTREAM_H__
+#define __INPUTSTREAM_H__
+
+using namespace std;
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <stdint.h>
+
+/* This class reads a file, or standard input when the file name is "-", and
+ * hands it out as lines or raw bytes.  Gzip and zstd compressed input is
+ * recognized by its magic number and decompressed transparently.  Reading and
+ * decompression run on a background thread that fills large buffers and passes
+ * them through a small bounded queue, so they overlap with parsing and the
+ * uncompressed data never touches the disk.
+ */
+class InputStream {
+ public:
+  // Opens filename ("-" for standard input) and starts the reader thread.
+  // The first start (uncompressed) bytes are skipped: seeked over in a
+  // plain file, read and dropped otherwise.
+  InputStream(string filename, uint64_t start = 0);
+
+  // Stops the reader thread and closes the input
+  ~InputStream();
+
+  // Returns true if the input could be opened
+  bool isOpen() { return myFd >= 0; };
+
+  // Returns true if the input could not be read or decompressed
+  bool hasError() { return myError; };
+
+  // Reads the next line, without its newline, into line.  Returns false at
+  // the end of the input.
+  bool getLine(string &line);
+
+  // Points text at the next line, without its newline, and sets length to
+  // its length.  The line is left in place in the input buffer when it can
+  // be, and stays valid until the next call; readable is set to the number
+  // of bytes (at least length) that may be read from text on.  Returns
+  // false at the end of the input.
+  bool getLine(const char *&text, size_t &length, size_t &readable);
+
+  // Reads up to n bytes into buf.  Returns the number of bytes read, which is
+  // less than n only at the end of the input.
+  size_t read(char *buf, size_t n);
+
+  // Drops the next n bytes.  Returns the number dropped, less than n only
+  // at the end of the input.
+  uint64_t skip(uint64_t n);
+
+  // Returns the number of (uncompressed) bytes handed out so far
+  uint64_t tell() { return myOffset; };
+
+ private:
+  // The kinds of input that are recognized
+  enum Compression { PLAIN, GZIP, ZSTD };
+
+  static const size_t BufferSize = 1 << 20;   // bytes per buffer
+  static const size_t QueueDepth = 4;         // buffers in flight
+
+  int myFd;                 // input file descriptor
+  bool myCloseFd;           // false for standard input
+  Compression myCompression;
+  bool myError;
+  int myReadErrno;          // errno of a failed read, or 0
+
+  vector<char> myHead;      // bytes read while sniffing the magic number
+  uint64_t myOffset;        // bytes handed out to the caller
+
+  // Buffer currently being consumed by the caller
+  vector<char> myCurrent;
+  size_t myPos;
+  string myLine;            // a line that spans two buffers
+
+  // Queue between the reader thread and the caller
+  mutex myLock;
+  condition_variable myFilled;     // signalled when a buffer is queued
+  condition_variable myDrained;    // signalled when a buffer is taken
+  deque< vector<char> > myFull;    // buffers ready to be consumed
+  vector< vector<char> > myFree;   // consumed buffers, kept for reuse
+  bool myEnd;                      // reader thread has queued its last buffer
+  atomic<bool> myStop;             // caller is going away
+  thread myReader;
+
+  // Body of the reader thread: reads, decompresses and queues buffers
+  void readerLoop();
+
+  // Reads raw bytes from the input, starting with myHead.  Returns the
+  // number of bytes read, 0 at the end of the input, on an error (which
+  // is kept in myReadErrno) or once the caller has stopped reading.
+  size_t readRaw(char *buf, size_t n);
+
+  // Returns true if readRaw has input to return within a few milliseconds
+  bool rawReady();
+
+  // Decompression loops used by readerLoop; return false on corrupt input
+  bool copyPlain();
+  bool inflateGzip();
+  bool inflateZstd();
+
+  // Returns an empty buffer of BufferSize bytes to fill
+  vector<char> getFreeBuffer();
+
+  // Queues buf (resized to its used length) for the caller.  Returns false
+  // if the caller has stopped reading.
+  bool putBuffer(vector<char> &buf);
+
+  // Makes myCurrent the next queued buffer.  Returns false at the end.
+  bool nextBuffer();
+};
+
+#endif
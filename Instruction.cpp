@@ -5,6 +5,7 @@ Instruction::Instruction()
 {
   myOpcode = UNDEFINED;
   myRS = myRT = myRD = NumRegisters;
+  myImmediate = 0;
   myEncoding = "";
   myAssembly = "";
 }
@@ -17,6 +18,7 @@ Instruction::Instruction(const Instruction & ref)
   myRS = ref.myRS;
   myRT = ref.myRT;
   myRD = ref.myRD;
+  myImmediate = ref.myImmediate;
   myEncoding = ref.myEncoding;
   myAssembly = ref.myAssembly;
 }
@@ -29,40 +31,30 @@ Instruction::Instruction(Opcode op, Register rs, Register rt, Register rd, int i
   setValues(op, rs, rt, rd, imm);
 }
 
-void Instruction::setValues(Opcode op, Register rs, Register rt, Register rd, int imm)
-// Allows you to set all the fields of the Instruction:
-// opcode, first source register, second source register, destination
-// register, and immediate value
+string Instruction::getStatement() const
+// Returns the assembly representation without the labels defined in front
+// of the instruction
 {
-
-  myOpcode = op;
-  if(op < 0 || op >= UNDEFINED)
-    myOpcode = UNDEFINED;
-
-  myRS = rs;
-  if(rs < 0 || rs >= NumRegisters)
-    myRS = NumRegisters;
-
-  myRT = rt;
-  if(rt < 0 || rt >= NumRegisters)
-    myRT = NumRegisters;
-
-  myRD = rd;
-  if(rd < 0 || rd >= NumRegisters)
-    myRD = NumRegisters;
-
-  myImmediate = imm;
-  if(!( (imm & 0xFFFF0000) << 1))  // make sure it has nothing in upper 16 bits
-    myImmediate = imm;  
+  size_t p = 0;
+  for(;;){
+    size_t start = myAssembly.find_first_not_of(" \t\r\f\v", p);
+    if(start == string::npos)
+      return myAssembly;
+    size_t end = myAssembly.find_first_of(" \t\r\f\v#", start);
+    if(end == string::npos)
+      end = myAssembly.size();
+    if(end == start || myAssembly[end - 1] != ':')
+      return p == 0 ? myAssembly : myAssembly.substr(start);
+    p = end;
+  }
 }
 
-InstType Instruction::getInstType()
+InstType Instruction::getInstType() const
 // Returns the type of instruction 
 {
-  OpcodeTable opTable;
   if(myOpcode == UNDEFINED)
     return INVALID;
 
-  return opTable.getInstType(myOpcode);
+  return OpcodeInfoTable[myOpcode].instType;
 }
 
@@ -32,34 +32,38 @@ class Instruction{
   void setValues(Opcode op, Register rs, Register rt, Register rd, int imm);
 
   // Returns the Opcode of the instruction
-  Opcode getOpcode()   { return myOpcode;}
+  Opcode getOpcode() const  { return myOpcode;}
 
   // Returns the register used as the first source operand
-  Register getRS()     { return myRS; };
+  Register getRS() const    { return myRS; };
 
   // Returns the register used as the second source operand
-  Register getRT()     { return myRT; };
+  Register getRT() const    { return myRT; };
 
   // Returns the register used as the destination register
-  Register getRD()     { return myRD; };
+  Register getRD() const    { return myRD; };
 
   // Returns the value of the instruction's immediate field
-  int getImmediate()   { return myImmediate; };
+  int getImmediate() const  { return myImmediate; };
 
   // Returns the type of instruction 
-  InstType getInstType();
+  InstType getInstType() const;
 
   // Sets the assembly representation of the instruction to the specified parameter
   void setAssembly(string assembly) { myAssembly = assembly; };
 
   // Returns the assembly representation of the instruction
-  string getAssembly() { return myAssembly;};
+  const string &getAssembly() const { return myAssembly;};
+
+  // Returns the assembly representation without the labels defined in front
+  // of the instruction
+  string getStatement() const;
 
   // Stores the 32 bit binary encoding of MIPS instruction passed in
   void setEncoding(string s) { myEncoding = s;};
 
   // Returns string representing the 32 binary encoding of MIPS instruction
-  string getEncoding() {return myEncoding; };
+  const string &getEncoding() const {return myEncoding; };
 
  private:
   Opcode myOpcode;
@@ -74,4 +78,31 @@ class Instruction{
 
 };
 
+inline void Instruction::setValues(Opcode op, Register rs, Register rt, Register rd, int imm)
+// Allows you to set all the fields of the Instruction:
+// opcode, first source register, second source register, destination
+// register, and immediate value
+{
+
+  myOpcode = op;
+  if((unsigned)op >= (unsigned)UNDEFINED)
+    myOpcode = UNDEFINED;
+
+  myRS = rs;
+  if((unsigned)rs >= (unsigned)NumRegisters)
+    myRS = NumRegisters;
+
+  myRT = rt;
+  if((unsigned)rt >= (unsigned)NumRegisters)
+    myRT = NumRegisters;
+
+  myRD = rd;
+  if((unsigned)rd >= (unsigned)NumRegisters)
+    myRD = NumRegisters;
+
+  myImmediate = imm;
+  if(!( (imm & 0xFFFF0000) << 1))  // make sure it has nothing in upper 16 bits
+    myImmediate = imm;  
+}
+
 #endif
@@ -0,0 +1,78 @@
+#include "InstructionLog.h"
+#include <algorithm>
+#include <string.h>
+
+InstructionLog::InstructionLog(size_t capacity)
+  // Keeps every instruction (capacity 0) or the last capacity instructions
+  : myCount(0)
+{
+  myCapacity = capacity;
+  myChunkUsed = myChunkCapacity = myChunkBytes = 0;
+  if(capacity != 0)
+    myRing.resize(capacity);
+}
+
+InstructionLog::~InstructionLog()
+  // Frees the chunks
+{
+  for(size_t c = 0; c < myChunks.size(); c++)
+    delete [] myChunks[c];
+}
+
+void InstructionLog::append(const string &assembly)
+  // Appends the text of the next instruction.  Only one thread may append.
+{
+  size_t count = myCount.load(memory_order_relaxed);
+  if(myCapacity != 0){
+    myRing[count % myCapacity] = assembly;
+    myCount.store(count + 1, memory_order_release);
+    return;
+  }
+
+  // start a new chunk when the text does not fit in the current one; a text
+  // longer than a chunk gets a chunk of its own
+  if(myChunks.size() == 0 || myChunkUsed + assembly.size() > myChunkCapacity){
+    myChunkCapacity = max(ChunkSize, assembly.size());
+    myChunks.push_back(new char[myChunkCapacity]);
+    myChunkBytes += myChunkCapacity;
+    myChunkUsed = 0;
+  }
+  memcpy(myChunks.back() + myChunkUsed, assembly.data(), assembly.size());
+  myChunkUsed += assembly.size();
+  myPositions.push_back(((uint64_t)(myChunks.size() - 1) << 32) | myChunkUsed);
+  myCount.store(count + 1, memory_order_release);
+}
+
+void InstructionLog::locate(size_t k, const char *&text, size_t &length) const
+  // Returns the text of instruction k in unbounded mode
+{
+  uint64_t pos = myPositions[k];
+  size_t chunk = pos >> 32;
+  size_t end = pos & 0xffffffff;
+  size_t start = 0;
+  if(k > 0 && (myPositions[k - 1] >> 32) == chunk)
+    start = myPositions[k - 1] & 0xffffffff;
+
+  text = myChunks[chunk] + start;
+  length = end - start;
+}
+string InstructionLog::get(size_t k) const
+  // Returns the text of instruction k, which must still be held
+{
+  if(myCapacity != 0)
+    return myRing[k % myCapacity];
+
+  const char *text;
+  size_t length;
+  locate(k, text, length);
+  return string(text, length);
+}
+
+size_t InstructionLog::memoryUsage() const
+  // Returns the number of bytes used to hold the text
+{
+  size_t bytes = myPositions.memoryUsage() + myChunks.memoryUsage() + myChunkBytes;
+  for(size_t r = 0; r < myRing.size(); r++)
+    bytes += sizeof(string) + myRing[r].capacity();
+  return bytes;
+}
@@ -0,0 +1,108 @@
+#ifndef __INSTRUCTIONLOG_H__
+#define __INSTRUCTIONLOG_H__
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+using namespace std;
+
+#include "ChunkedArray.h"
+
+/* This class keeps the assembly text of a numbered sequence of instructions
+ * for the report, separately from the dependence analysis.  By default the
+ * text of every instruction is kept in an append-only list of large chunks,
+ * with one packed position per instruction.  Given a capacity, only the text
+ * of the most recent capacity instructions is kept, in a ring of reused
+ * strings, for runs that do not print the full report.
+ *
+ * In the default mode one thread may append while others read: chunks
+ * never move and the count is published after each append, so the text of
+ * every instruction below size() can be read at any time.  The ring mode
+ * reuses its strings and is for a single thread.
+ */
+class InstructionLog {
+ public:
+  // Keeps every instruction (capacity 0) or the last capacity instructions
+  InstructionLog(size_t capacity = 0);
+
+  // Frees the chunks
+  ~InstructionLog();
+
+  // Appends the text of the next instruction.  Only one thread may append.
+  void append(const string &assembly);
+
+  // Returns the number of instructions appended (published)
+  size_t size() const { return myCount.load(memory_order_acquire); };
+
+  // Returns the number of the oldest instruction whose text is still held
+  size_t first() const {
+    size_t count = size();
+    return (myCapacity == 0 || count <= myCapacity) ? 0 : count - myCapacity;
+  };
+
+  // Returns the text of instruction k, which must still be held
+  string get(size_t k) const;
+
+  // Calls f(k, text, length) for every instruction k in [from, to) whose
+  // text is still held, in order
+  template<class F>
+  void forEach(size_t from, size_t to, F f) const;
+
+  // Returns the number of bytes used to hold the text
+  size_t memoryUsage() const;
+
+ private:
+  static const size_t ChunkSize = 1 << 20;
+
+  size_t myCapacity;
+  atomic<size_t> myCount;
+
+  // Unbounded mode: text in chunks; an instruction never spans two chunks.
+  // Position = chunk index << 32 | offset of the end of the text in the
+  // chunk; the text starts at the end of the previous one in the same chunk,
+  // or at the start of the chunk.
+  ChunkedArray<char *> myChunks;
+  ChunkedArray<uint64_t> myPositions;
+  size_t myChunkUsed;                  // bytes used in the last chunk
+  size_t myChunkCapacity;              // its size
+  size_t myChunkBytes;                 // size of all the chunks
+
+  InstructionLog(const InstructionLog &);
+  InstructionLog &operator=(const InstructionLog &);
+
+  // Bounded mode: ring of the last myCapacity texts
+  vector<string> myRing;
+
+  // Returns the text of instruction k in unbounded mode
+  void locate(size_t k, const char *&text, size_t &length) const;
+};
+
+
+template<class F>
+void InstructionLog::forEach(size_t from, size_t to, F f) const
+  // Calls f(k, text, length) for every instruction k in [from, to) whose
+  // text is still held, in order
+{
+  if(from < first())
+    from = first();
+  if(to > size())
+    to = size();
+
+  for(size_t k = from; k < to; k++){
+    if(myCapacity != 0){
+      const string &s = myRing[k % myCapacity];
+      f(k, s.data(), s.size());
+    }
+    else{
+      const char *text;
+      size_t length;
+      locate(k, text, length);
+      f(k, text, length);
+    }
+  }
+}
+
+#endif
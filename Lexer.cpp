@@ -0,0 +1,107 @@
+#include "Lexer.h"
+#include <string.h>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+void classifyBlock(const char *p, size_t n, size_t readable, DelimiterMasks &m)
+  // Classifies bytes [p, p + n) of a block, n <= LexBlockSize.  Bits at and
+  // above n are clear.  readable is the number of bytes that may be read from
+  // p on; with a whole block readable the bytes are loaded in place, else
+  // they are first copied to a padded block.
+{
+  // Pad a short block to a whole one with NULs, which are not delimiters
+  alignas(32) char padded[LexBlockSize];
+  const char *block = p;
+  if(readable < LexBlockSize){
+    memcpy(padded, p, n);
+    memset(padded + n, 0, LexBlockSize - n);
+    block = padded;
+  }
+
+#if defined(__AVX2__)
+  __m256i lo = _mm256_loadu_si256((const __m256i *)block);
+  __m256i hi = _mm256_loadu_si256((const __m256i *)(block + 32));
+  auto mask = [&](char c){
+    __m256i v = _mm256_set1_epi8(c);
+    uint64_t l = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, v));
+    uint64_t h = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, v));
+    return l | (h << 32);
+  };
+#elif defined(__SSE2__)
+  __m128i q[4];
+  for(int k = 0; k < 4; k++)
+    q[k] = _mm_loadu_si128((const __m128i *)(block + 16 * k));
+  auto mask = [&](char c){
+    __m128i v = _mm_set1_epi8(c);
+    uint64_t r = 0;
+    for(int k = 0; k < 4; k++)
+      r |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(q[k], v)) << (16 * k);
+    return r;
+  };
+#else
+  auto mask = [&](char c){
+    uint64_t r = 0;
+    for(size_t k = 0; k < LexBlockSize; k++)
+      r |= (uint64_t)(block[k] == c) << k;
+    return r;
+  };
+#endif
+
+  // bytes past the block read in place belong to the next line
+  uint64_t valid = n < LexBlockSize ? ((uint64_t)1 << n) - 1 : ~(uint64_t)0;
+  m.space = (mask(' ') | mask('\t')) & valid;
+  m.comma = mask(',') & valid;
+  m.hash = mask('#') & valid;
+  m.lparen = mask('(') & valid;
+  m.rparen = mask(')') & valid;
+}
+
+
+bool parseNumber(const char *s, size_t len, int &value)
+  // Parses an optionally signed decimal or 0x-prefixed hexadecimal integer in
+  // s[0, len) in a single pass.  Returns false if the text is not a number.
+  // Values beyond the range of int saturate so they fail later range checks.
+{
+  size_t k = 0;
+  bool negative = false;
+  if(len > 0 && (s[0] == '-' || s[0] == '+')){
+    negative = (s[0] == '-');
+    k++;
+  }
+
+  int base = 10;
+  if(len - k > 2 && s[k] == '0' && (s[k + 1] == 'x' || s[k + 1] == 'X')){
+    base = 16;
+    k += 2;
+  }
+  if(k == len)
+    return false;
+
+  const int64_t limit = (int64_t)1 << 32;
+  int64_t v = 0;
+  for(; k < len; k++){
+    char c = s[k];
+    int d;
+    if(c >= '0' && c <= '9')
+      d = c - '0';
+    else if(base == 16 && c >= 'a' && c <= 'f')
+      d = c - 'a' + 10;
+    else if(base == 16 && c >= 'A' && c <= 'F')
+      d = c - 'A' + 10;
+    else
+      return false;
+    v = v * base + d;
+    if(v > limit)
+      v = limit;
+  }
+
+  if(negative)
+    v = -v;
+  if(v > INT32_MAX)
+    v = INT32_MAX;
+  if(v < INT32_MIN)
+    v = INT32_MIN;
+  value = (int)v;
+  return true;
+}
@@ -0,0 +1,53 @@
+#ifndef __LEXER_H__
+#define __LEXER_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Character classification for the assembly tokenizer.  A block of up to 64
+ * bytes is compared against every delimiter at once (with AVX2 or SSE2 when
+ * the compiler targets them, one byte at a time otherwise) and the result is
+ * one bitmask per delimiter class: bit k is set when byte k of the block
+ * belongs to the class.  The tokenizer then finds token boundaries by
+ * scanning bits instead of characters.
+ */
+
+// A token: bytes [text, text + length) of a line
+struct Token {
+  const char *text;
+  size_t length;
+};
+
+// Number of bytes classified at once
+const size_t LexBlockSize = 64;
+
+// Delimiter bitmasks of one block
+struct DelimiterMasks {
+  uint64_t space;     // ' ' or '\t'
+  uint64_t comma;     // ','
+  uint64_t hash;      // '#', start of a comment
+  uint64_t lparen;    // '('
+  uint64_t rparen;    // ')'
+};
+
+// Classifies bytes [p, p + n) of a block, n <= LexBlockSize.  Bits at and
+// above n are clear.  readable is the number of bytes that may be read from
+// p on; with a whole block readable the bytes are loaded in place, else
+// they are first copied to a padded block.
+void classifyBlock(const char *p, size_t n, size_t readable, DelimiterMasks &m);
+
+// Returns the index of the first set bit of m at or after bit k, or 64
+inline int nextSetBit(uint64_t m, int k)
+{
+  if(k >= 64)
+    return 64;
+  m &= ~(uint64_t)0 << k;
+  return m ? __builtin_ctzll(m) : 64;
+}
+
+// Parses an optionally signed decimal or 0x-prefixed hexadecimal integer in
+// s[0, len) in a single pass.  Returns false if the text is not a number.
+// Values beyond the range of int saturate so they fail later range checks.
+bool parseNumber(const char *s, size_t len, int &value);
+
+#endif
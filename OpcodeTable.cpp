@@ -1,124 +1,115 @@
 #include "OpcodeTable.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
 
-OpcodeTable::OpcodeTable()
-// Initializes all the fields for every instruction in Opcode enum
-{
-  myArray[ADD].name = "add";  myArray[ADD].numOps = 3;   myArray[ADD].rdPos = 0;  myArray[ADD].rsPos = 1;  myArray[ADD].rtPos = 2;   myArray[ADD].immPos = -1;  myArray[ADD].instType = RTYPE; myArray[ADD].op_field = "000000"; myArray[ADD].funct_field = "100000";
- 
- myArray[ADDI].name = "addi";  myArray[ADDI].numOps = 3;   myArray[ADDI].rdPos = -1;  myArray[ADDI].rsPos = 1;  myArray[ADDI].rtPos = 0;   myArray[ADDI].immPos = 2;  myArray[ADDI].instType = ITYPE; myArray[ADDI].op_field = "001000"; myArray[ADDI].funct_field = "";
-
-  myArray[XOR].name = "xor";  myArray[XOR].numOps = 3;   myArray[XOR].rdPos = 0;  myArray[XOR].rsPos = 1;  myArray[XOR].rtPos = 2;   myArray[XOR].immPos = -1;  myArray[XOR].instType = RTYPE; myArray[XOR].op_field = "000000"; myArray[XOR].funct_field = "100110";
-
-  myArray[MULT].name = "mult";  myArray[MULT].numOps = 2;   myArray[MULT].rdPos = -1;  myArray[MULT].rsPos = 0;  myArray[MULT].rtPos = 1;   myArray[MULT].immPos = -1;  myArray[MULT].instType = RTYPE; myArray[MULT].op_field = "000000"; myArray[MULT].funct_field = "011000";
-
-  myArray[MFLO].name = "mflo";  myArray[MFLO].numOps = 1;   myArray[MFLO].rdPos = 0;  myArray[MFLO].rsPos = -1;  myArray[MFLO].rtPos = -1;   myArray[MFLO].immPos = -1;  myArray[MFLO].instType = RTYPE; myArray[MFLO].op_field = "000000"; myArray[MFLO].funct_field = "010010";
-
-  myArray[SLL].name = "sll";  myArray[SLL].numOps = 3;   myArray[SLL].rdPos = 0;  myArray[SLL].rsPos = -1;  myArray[SLL].rtPos = 1;   myArray[SLL].immPos = 2;  myArray[SLL].instType = RTYPE; myArray[SLL].op_field = "000000"; myArray[SLL].funct_field = "000000";
-
-  myArray[SLT].name = "slt";  myArray[SLT].numOps = 3;   myArray[SLT].rdPos = 0;  myArray[SLT].rsPos = 1;  myArray[SLT].rtPos = 2;   myArray[SLT].immPos = -1; myArray[SLT].instType = RTYPE; myArray[SLT].op_field = "000000"; myArray[SLT].funct_field = "101010";
-
-  myArray[SLTI].name = "slti";  myArray[SLTI].numOps = 3;   myArray[SLTI].rdPos = -1;  myArray[SLTI].rsPos = 1;  myArray[SLTI].rtPos = 0;   myArray[SLTI].immPos = 2; myArray[SLTI].instType = ITYPE; myArray[SLTI].op_field = "001010"; myArray[SLTI].funct_field = "";
-
-  myArray[LB].name = "lb";  myArray[LB].numOps = 3;   myArray[LB].rdPos = -1;  myArray[LB].rsPos = 2;  myArray[LB].rtPos = 0;   myArray[LB].immPos = 1;  myArray[LB].instType = ITYPE; myArray[LB].op_field = "100000"; myArray[LB].funct_field = "";
-
-  myArray[J].name = "j";  myArray[J].numOps = 1;   myArray[J].rdPos = -1;  myArray[J].rsPos = -1;  myArray[J].rtPos = -1;   myArray[J].immPos = 0;  myArray[J].instType = JTYPE; myArray[J].op_field = "000010"; myArray[J].funct_field = ""; myArray[J].immLabel = true;
-
-}
-
-Opcode OpcodeTable::getOpcode(string str)
+Opcode OpcodeTable::getOpcode(const string &str) const
 // Given a valid MIPS assembly mnemonic, returns an Opcode which represents a 
 // template for that instruction.
 {
-  for(int i = 0; i < (int)UNDEFINED; i++){
-    if(myArray[i].name == str){
-      return (Opcode)i;
-    }
-  }
-  return UNDEFINED;
-}
-
-
-int OpcodeTable::numOperands(Opcode o)
-// Given an Opcode, returns number of expected operands.
-{
-  if(o < 0 || o >= UNDEFINED)
-    return -1;
-
-  return myArray[o].numOps;
-}
-
-
-int OpcodeTable::RSposition(Opcode o)
-// Given an Opcode, returns the position of RS field.  If field is not
-// appropriate for this Opcode, returns -1.
-{
-  if(o < 0 || o >= UNDEFINED)
-    return -1;
-
-  return myArray[o].rsPos;
-}
-
-int OpcodeTable::RTposition(Opcode o)
-// Given an Opcode, returns the position of RT field.  If field is not
-// appropriate for this Opcode, returns -1.
-{
-  if(o < 0 || o >= UNDEFINED)
-    return -1;
-
-  return myArray[o].rtPos;
+  return getOpcode(str.data(), str.length());
 }
 
-int OpcodeTable::RDposition(Opcode o)
-// Given an Opcode, returns the position of RD field.  If field is not
-// appropriate for this Opcode, returns -1.
+// Returns the bytes of a mnemonic of at most 8 bytes as one integer, 0 for
+// a longer one
+static uint64_t mnemonicKey(const char *str, size_t length)
 {
-  if(o < 0 || o >= UNDEFINED)
-    return -1;
-
-  return myArray[o].rdPos;
+  uint64_t key = 0;
+  if(length <= sizeof(key))
+    memcpy(&key, str, length);
+  return key;
 }
 
-int OpcodeTable::IMMposition(Opcode o)
-// Given an Opcode, returns the position of IMM field.  If field is not
-// appropriate for this Opcode, returns -1.
+Opcode OpcodeTable::getOpcode(const char *str, size_t length) const
+// Same, for the mnemonic in str[0, length)
 {
-  if(o < 0 || o >= UNDEFINED)
-    return -1;
-
-  return myArray[o].immPos;
-}
+  // short mnemonics (all of them, so far) are compared as integers
+  static const vector<uint64_t> keys = [](){
+    vector<uint64_t> k;
+    for(int i = 0; i < (int)UNDEFINED; i++)
+      k.push_back(mnemonicKey(OpcodeInfoTable[i].name, strlen(OpcodeInfoTable[i].name)));
+    return k;
+  }();
+  if(length > 0 && length <= sizeof(uint64_t)){
+    // 0 stands for the long mnemonics; no mnemonic is only NUL bytes
+    uint64_t key = mnemonicKey(str, length);
+    if(key == 0)
+      return UNDEFINED;
+    for(int i = 0; i < (int)UNDEFINED; i++)
+      if(keys[i] == key)
+	return (Opcode)i;
+    return UNDEFINED;
+  }
 
-InstType OpcodeTable::getInstType(Opcode o)
-// Given an Opcode, returns instruction type.
-{
-  if(o < 0 || o > UNDEFINED)
-    return (InstType)-1;
-  return myArray[o].instType;
+  for(int i = 0; i < (int)UNDEFINED; i++){
+    const char *name = OpcodeInfoTable[i].name;
+    if(strlen(name) == length && memcmp(name, str, length) == 0){
+      return (Opcode)i;
+    }
+  }
+  return UNDEFINED;
 }
 
-string OpcodeTable::getOpcodeField(Opcode o)
+string OpcodeTable::getOpcodeField(Opcode o) const
 // Given an Opcode, returns a string representing the binary encoding of the opcode
 // field.
 {
-  if(o < 0 || o > UNDEFINED)
+  if(!isValid(o))
     return string("");
-  return myArray[o].op_field;
+  return fieldString(OpcodeInfoTable[o].opBits);
 }
 
-string OpcodeTable::getFunctField(Opcode o)
+string OpcodeTable::getFunctField(Opcode o) const
 // Given an Opcode, returns a string representing the binary encoding of the function
 // field.
 {
-  if(o < 0 || o > UNDEFINED)
+  if(!isValid(o) || OpcodeInfoTable[o].functBits == -1)
     return string("");
-  return myArray[o].funct_field;
+  return fieldString(OpcodeInfoTable[o].functBits);
+}
+
+string OpcodeTable::fieldString(int value)
+// Returns the low 6 bits of value as a string of '0' and '1'
+{
+  string s(6, '0');
+  for(int b = 0; b < 6; b++){
+    if(value & (1 << (5 - b)))
+      s[b] = '1';
+  }
+  return s;
 }
 
-bool OpcodeTable::isIMMLabel(Opcode o)
-// Given an Opcode, returns true if instruction expects a label in the instruction.
-// See "J".
+string OpcodeTable::toAssembly(Opcode o, int rs, int rt, int rd, int imm) const
+// Given an Opcode and the values of its fields, returns the assembly form of the
+// instruction, e.g. "lb $1, 100($2)".  Register numbers are printed as given, so
+// they may be larger than NumRegisters.  Jump targets are printed in hex.
 {
-  if(o < 0 || o > UNDEFINED)
-    return false;
-  return myArray[o].immLabel;
+  if(!isValid(o))
+    return "";
+  const OpcodeInfo &info = OpcodeInfoTable[o];
+
+  string out = info.name;
+  char number[16];
+  for(int p = 0; p < info.numOps; p++){
+    out += (p == 0 ? " " : ", ");
+    if(p == info.rdPos)
+      out += "$" + to_string(rd);
+    else if(p == info.rtPos)
+      out += "$" + to_string(rt);
+    else if(p == info.rsPos)
+      out += "$" + to_string(rs);
+    else if(info.instType == JTYPE){
+      snprintf(number, sizeof(number), "0x%x", (unsigned)imm);
+      out += number;
+    }
+    else if(info.instType == ITYPE && info.rsPos == p + 1){
+      // base register follows the offset: offset(base)
+      out += to_string(imm) + "($" + to_string(rs) + ")";
+      break;
+    }
+    else
+      out += to_string(imm);
+  }
+  return out;
 }
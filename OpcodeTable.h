@@ -7,21 +7,6 @@ using namespace std;
 #include <string>
 
 
-// Listing of all supported MIPS instructions
-enum Opcode {
-  ADD, 
-  ADDI, 
-  XOR,
-  MULT,
-  MFLO,
-  SLL,
-  SLT,
-  SLTI,
-  LB,
-  J, 
-  UNDEFINED
-};
-
 // Different types of MIPS encodings
 enum InstType{
   RTYPE,
@@ -30,84 +15,144 @@ enum InstType{
   INVALID
 };
 
+/* The ISA description.  Every supported MIPS instruction is one X() entry:
+ *
+ *   X(enum, mnemonic, #operands, RD pos, RS pos, RT pos, IMM pos,
+ *     immediate may be a label, instruction type, opcode field, funct field)
+ *
+ * Operand positions are -1 when the field is not used.  The funct field is -1
+ * for instructions that have none.  Everything else in this file (the Opcode
+ * enum, the lookup table and the per-opcode handler tables in ASMParser and
+ * DependencyChecker) is generated from this list.
+ */
+#define OPCODE_LIST(X)                                                      \
+  X(ADD,  "add",  3,  0,  1,  2, -1, false, RTYPE, 0x00, 0x20)              \
+  X(ADDI, "addi", 3, -1,  1,  0,  2, false, ITYPE, 0x08,   -1)              \
+  X(XOR,  "xor",  3,  0,  1,  2, -1, false, RTYPE, 0x00, 0x26)              \
+  X(MULT, "mult", 2, -1,  0,  1, -1, false, RTYPE, 0x00, 0x18)              \
+  X(MFLO, "mflo", 1,  0, -1, -1, -1, false, RTYPE, 0x00, 0x12)              \
+  X(SLL,  "sll",  3,  0, -1,  1,  2, false, RTYPE, 0x00, 0x00)              \
+  X(SLT,  "slt",  3,  0,  1,  2, -1, false, RTYPE, 0x00, 0x2a)              \
+  X(SLTI, "slti", 3, -1,  1,  0,  2, false, ITYPE, 0x0a,   -1)              \
+  X(LB,   "lb",   3, -1,  2,  0,  1, false, ITYPE, 0x20,   -1)              \
+  X(J,    "j",    1, -1, -1, -1,  0, true,  JTYPE, 0x02,   -1)
+
+// Listing of all supported MIPS instructions
+enum Opcode {
+#define OPCODE_ENUM(op, ...) op,
+  OPCODE_LIST(OPCODE_ENUM)
+#undef OPCODE_ENUM
+  UNDEFINED
+};
+
+// Provides information about how where to find values in a MIPS assembly
+// instruction and what pre-defined fields (opcode/funct) will be in
+// the encoding for the given instruction.
+struct OpcodeInfo {
+  const char *name;
+  int numOps;
+  int rdPos;
+  int rsPos;
+  int rtPos;
+  int immPos;
+  bool immLabel;
+
+  InstType instType;
+  int opBits;       // value of the 6 bit opcode field
+  int functBits;    // value of the 6 bit funct field, -1 if there is none
+};
+
+// One OpcodeInfo per Opcode, built at compile time from OPCODE_LIST
+inline constexpr OpcodeInfo OpcodeInfoTable[UNDEFINED] = {
+#define OPCODE_INFO(op, name, ops, rd, rs, rt, imm, label, type, opb, fn) \
+  { name, ops, rd, rs, rt, imm, label, type, opb, fn },
+  OPCODE_LIST(OPCODE_INFO)
+#undef OPCODE_INFO
+};
+
+// Register fields read and written by an instruction.  R-type instructions
+// read RS and RT and write RD when those operands exist; I-type instructions
+// read RS and write RT.
+constexpr bool readsRS(Opcode o)  { return OpcodeInfoTable[o].rsPos != -1; }
+constexpr bool readsRT(Opcode o)  { return OpcodeInfoTable[o].rtPos != -1 &&
+                                           OpcodeInfoTable[o].instType != ITYPE; }
+constexpr bool writesRD(Opcode o) { return OpcodeInfoTable[o].rdPos != -1; }
+constexpr bool writesRT(Opcode o) { return OpcodeInfoTable[o].rtPos != -1 &&
+                                           OpcodeInfoTable[o].instType == ITYPE; }
+
+// mult writes the HI and LO registers and mflo reads LO.  They are not among
+// the numbered registers, so DependencyChecker does not see them; code that
+// reorders instructions or times them must.
+constexpr bool writesLO(Opcode o) { return o == MULT; }
+constexpr bool readsLO(Opcode o)  { return o == MFLO; }
+
 
 /* This class represents templates for supported MIPS instructions.  For every supported
  * MIPS instruction, the OpcodeTable includes information about the opcode, expected
- * operands, and other fields.  
+ * operands, and other fields.  All of the information comes from OpcodeInfoTable,
+ * so constructing an OpcodeTable costs nothing.
  */
 class OpcodeTable {
  public:
-  // Initializes all the fields for every instruction in Opcode enum
-  OpcodeTable();
-
   // Given a valid MIPS assembly mnemonic, returns an Opcode which represents a 
   // template for that instruction.
-  Opcode getOpcode(string str);
+  Opcode getOpcode(const string &str) const;
+
+  // Same, for the mnemonic in str[0, length)
+  Opcode getOpcode(const char *str, size_t length) const;
 
   // Given an Opcode, returns number of expected operands.
-  int numOperands(Opcode o);
+  int numOperands(Opcode o) const
+    { return isValid(o) ? OpcodeInfoTable[o].numOps : -1; };
 
   // Given an Opcode, returns the position of RS field.  If field is not
   // appropriate for this Opcode, returns -1.
-  int RSposition(Opcode o);
+  int RSposition(Opcode o) const
+    { return isValid(o) ? OpcodeInfoTable[o].rsPos : -1; };
 
   // Given an Opcode, returns the position of RT  field.  If field is not
   // appropriate for this Opcode, returns -1.
-  int RTposition(Opcode o);
+  int RTposition(Opcode o) const
+    { return isValid(o) ? OpcodeInfoTable[o].rtPos : -1; };
 
   // Given an Opcode, returns the position of RD field.  If field is not
   // appropriate for this Opcode, returns -1.
-  int RDposition(Opcode o);
+  int RDposition(Opcode o) const
+    { return isValid(o) ? OpcodeInfoTable[o].rdPos : -1; };
 
   // Given an Opcode, returns the position of IMM field.  If field is not
   // appropriate for this Opcode, returns -1.
-  int IMMposition(Opcode o);
+  int IMMposition(Opcode o) const
+    { return isValid(o) ? OpcodeInfoTable[o].immPos : -1; };
 
   // Given an Opcode, returns true if instruction expects a label in the instruction.
   // See "J".
-  bool isIMMLabel(Opcode o);
+  bool isIMMLabel(Opcode o) const
+    { return isValid(o) ? OpcodeInfoTable[o].immLabel : false; };
 
   // Given an Opcode, returns instruction type.
-  InstType getInstType(Opcode o);
+  InstType getInstType(Opcode o) const
+    { return isValid(o) ? OpcodeInfoTable[o].instType : INVALID; };
 
   // Given an Opcode, returns a string representing the binary encoding of the opcode
   // field.
-  string getOpcodeField(Opcode o);
+  string getOpcodeField(Opcode o) const;
 
   // Given an Opcode, returns a string representing the binary encoding of the function
   // field.
-  string getFunctField(Opcode o);
+  string getFunctField(Opcode o) const;
 
+  // Given an Opcode and the values of its fields, returns the assembly form of the
+  // instruction, e.g. "lb $1, 100($2)".  Register numbers are printed as given, so
+  // they may be larger than NumRegisters.  Jump targets are printed in hex.
+  string toAssembly(Opcode o, int rs, int rt, int rd, int imm) const;
 
  private:
-  // Provides information about how where to find values in a MIPS assembly
-  // instruction and what pre-defined fields (opcode/funct) will be in
-  // the encoding for the given instruction.
-  struct OpcodeTableEntry{
-    string name;
-    int numOps;
-    int rdPos;
-    int rsPos;
-    int rtPos;
-    int immPos;
-    bool immLabel;
-
-    InstType instType;
-    string op_field;
-    string funct_field;
-
-    // Creates an initial OpcodeTableEntry with default values
-    OpcodeTableEntry(){
-      numOps = 0; 
-      rdPos = rsPos = rtPos = immPos = -1;
-      immLabel = false;
-    };
-  };
-
-  // The array of OpcodeTableEntries, one for each MIPS instruction supported
-  OpcodeTableEntry myArray[UNDEFINED];
-
+  // Returns true if o names one of the supported instructions
+  static bool isValid(Opcode o) { return o >= 0 && o < UNDEFINED; };
 
+  // Returns the low 6 bits of value as a string of '0' and '1'
+  static string fieldString(int value);
 };
 
 
@@ -0,0 +1,295 @@
+#include "PerfCounters.h"
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <mutex>
+#include <algorithm>
+
+bool PerfCounters::ourEnabled = false;
+
+static const char *PhaseName[NumPerfPhases] = {
+  "tokenize", "operands", "decode", "check", "output"
+};
+static const uint64_t EventConfig[NumPerfEvents] = {
+  PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+  PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+};
+
+// Counts of one phase
+struct PhaseCounts {
+  uint64_t calls;                    // times the phase was entered
+  uint64_t measured;                 // calls whose counters were read
+  uint64_t nanoseconds;              // thread CPU time of the measured calls
+  uint64_t events[NumPerfEvents];    // events of the measured calls
+};
+
+// Counts of the threads that have finished, and what could be opened
+static mutex totalsLock;
+static PhaseCounts totals[NumPerfPhases];
+static bool eventOpened[NumPerfEvents];
+static bool multiplexed;                 // some counter was not always counting
+static string openError;
+
+/* The counters of one thread.  They are opened when the thread first enters
+ * a phase, and their counts are added to the totals when the thread exits.
+ */
+class ThreadCounters {
+ public:
+  ThreadCounters();
+  ~ThreadCounters();
+
+  void begin(PerfPhase p);
+  void end(PerfPhase p);
+
+  // Adds the counts to the totals and clears them
+  void merge();
+
+ private:
+  int myLeader;                          // group leader, or -1
+  int myFds[NumPerfEvents];
+  int myIndex[NumPerfEvents];            // position in a group read, or -1
+  int myOpen;                            // counters in the group
+  uint64_t myOverheadTime;               // what measuring nothing costs
+  uint64_t myOverhead[NumPerfEvents];
+  bool myMultiplexed;                    // a read was scaled
+
+  int myDepth[NumPerfPhases];            // nesting of each phase
+  bool myMeasuring[NumPerfPhases];
+  uint64_t myStartTime[NumPerfPhases];
+  uint64_t myStart[NumPerfPhases][NumPerfEvents];
+  PhaseCounts myCounts[NumPerfPhases];
+
+  // Reads the thread CPU time and the counters
+  void read(uint64_t &nanoseconds, uint64_t *values);
+
+  // Sets myOverhead to the smallest counts between two reads in a row
+  void calibrate();
+};
+
+// Returns the counters of the calling thread
+static ThreadCounters &threadCounters()
+{
+  thread_local ThreadCounters counters;
+  return counters;
+}
+
+ThreadCounters::ThreadCounters()
+{
+  memset(myCounts, 0, sizeof(myCounts));
+  memset(myDepth, 0, sizeof(myDepth));
+  memset(myMeasuring, 0, sizeof(myMeasuring));
+  myLeader = -1;
+  myOpen = 0;
+  myMultiplexed = false;
+
+  // the first counter that opens leads the group, so all are read at once
+  string error;
+  for(int e = 0; e < NumPerfEvents; e++){
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = EventConfig[e];
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+      PERF_FORMAT_TOTAL_TIME_RUNNING;
+    myFds[e] = syscall(__NR_perf_event_open, &attr, 0, -1, myLeader, 0);
+    myIndex[e] = -1;
+    if(myFds[e] < 0){
+      if(error.empty())
+	error = strerror(errno);
+      continue;
+    }
+    if(myLeader == -1)
+      myLeader = myFds[e];
+    myIndex[e] = myOpen++;
+  }
+
+  calibrate();
+
+  lock_guard<mutex> lock(totalsLock);
+  for(int e = 0; e < NumPerfEvents; e++)
+    if(myIndex[e] != -1)
+      eventOpened[e] = true;
+  if(openError.empty())
+    openError = error;
+}
+
+ThreadCounters::~ThreadCounters()
+{
+  merge();
+  for(int e = 0; e < NumPerfEvents; e++)
+    if(myFds[e] >= 0)
+      close(myFds[e]);
+}
+
+void ThreadCounters::read(uint64_t &nanoseconds, uint64_t *values)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+  nanoseconds = (uint64_t)t.tv_sec * 1000000000 + t.tv_nsec;
+
+  // number of counters, time enabled, time running, then the counts
+  uint64_t group[3 + NumPerfEvents];
+  if(myLeader == -1 || ::read(myLeader, group, sizeof(group)) < (ssize_t)(3 * sizeof(uint64_t)))
+    group[0] = 0;
+
+  // When more counters are wanted than the hardware has, the kernel takes
+  // turns with them; the counts are then scaled up to the whole time
+  double scale = 1;
+  if(group[0] > 0 && group[2] < group[1]){
+    scale = group[2] ? (double)group[1] / group[2] : 0;
+    myMultiplexed = true;
+  }
+  for(int e = 0; e < NumPerfEvents; e++)
+    values[e] = (myIndex[e] != -1 && (uint64_t)myIndex[e] < group[0]) ?
+      (uint64_t)(group[3 + myIndex[e]] * scale) : 0;
+}
+
+void ThreadCounters::calibrate()
+{
+  uint64_t t0, t1, v0[NumPerfEvents], v1[NumPerfEvents];
+
+  myOverheadTime = ~(uint64_t)0;
+  for(int e = 0; e < NumPerfEvents; e++)
+    myOverhead[e] = ~(uint64_t)0;
+  for(int k = 0; k < 64; k++){
+    read(t0, v0);
+    read(t1, v1);
+    myOverheadTime = min(myOverheadTime, t1 - t0);
+    for(int e = 0; e < NumPerfEvents; e++)
+      myOverhead[e] = min(myOverhead[e], v1[e] - v0[e]);
+  }
+}
+
+void ThreadCounters::begin(PerfPhase p)
+{
+  if(myDepth[p]++ > 0)
+    return;
+  myMeasuring[p] = (myCounts[p].calls++ % PerfCounters::SampleEvery == 0);
+  if(myMeasuring[p])
+    read(myStartTime[p], myStart[p]);
+}
+
+void ThreadCounters::end(PerfPhase p)
+{
+  if(--myDepth[p] > 0 || !myMeasuring[p])
+    return;
+
+  uint64_t time, values[NumPerfEvents];
+  read(time, values);
+  PhaseCounts &c = myCounts[p];
+  c.measured++;
+  // take off the cost of the reads themselves
+  uint64_t d = time - myStartTime[p];
+  c.nanoseconds += d > myOverheadTime ? d - myOverheadTime : 0;
+  for(int e = 0; e < NumPerfEvents; e++){
+    d = values[e] - myStart[p][e];
+    c.events[e] += d > myOverhead[e] ? d - myOverhead[e] : 0;
+  }
+}
+
+void ThreadCounters::merge()
+{
+  lock_guard<mutex> lock(totalsLock);
+  multiplexed = multiplexed || myMultiplexed;
+  for(int p = 0; p < NumPerfPhases; p++){
+    totals[p].calls += myCounts[p].calls;
+    totals[p].measured += myCounts[p].measured;
+    totals[p].nanoseconds += myCounts[p].nanoseconds;
+    for(int e = 0; e < NumPerfEvents; e++)
+      totals[p].events[e] += myCounts[p].events[e];
+  }
+  memset(myCounts, 0, sizeof(myCounts));
+}
+
+
+void PerfCounters::begin(PerfPhase p)
+  // Enters phase p on the calling thread
+{
+  threadCounters().begin(p);
+}
+
+void PerfCounters::end(PerfPhase p)
+  // Leaves phase p on the calling thread
+{
+  threadCounters().end(p);
+}
+
+void PerfCounters::print(ostream &out, uint64_t numInstructions)
+  // Prints the counts of every phase of every thread that has finished (and
+  // of the calling thread), in total and per million of the numInstructions
+  // MIPS instructions analyzed
+{
+  threadCounters().merge();
+  lock_guard<mutex> lock(totalsLock);
+
+  bool hardware = false;
+  for(int e = 0; e < NumPerfEvents; e++)
+    hardware = hardware || eventOpened[e];
+  if(hardware)
+    out << "PERF COUNTERS: hardware, 1 call in " << SampleEvery << " measured"
+	<< (multiplexed ? "; counters multiplexed, counts scaled to the time enabled" : "")
+	<< endl;
+  else
+    out << "PERF COUNTERS: hardware counters unavailable (" << openError
+	<< "); thread CPU time only, 1 call in " << SampleEvery << " measured" << endl;
+
+  // scales the counts of the measured calls up to all calls
+  auto scaled = [](const PhaseCounts &c, uint64_t v){
+    return c.measured ? (double)v * c.calls / c.measured : 0.0;
+  };
+  auto event = [&](const PhaseCounts &c, PerfEvent e, double per){
+    if(!eventOpened[e])
+      out << " \t-";
+    else
+      out << " \t" << scaled(c, c.events[e]) / per;
+  };
+
+  out.setf(ios::fixed);
+  out.precision(0);
+  out << "Phase Calls Time(ms) Cycles Instructions IPC CacheMisses BranchMisses" << endl;
+  for(int p = 0; p < NumPerfPhases; p++){
+    const PhaseCounts &c = totals[p];
+    if(c.calls == 0)
+      continue;
+    out << PhaseName[p] << " \t" << c.calls;
+    out.precision(1);
+    out << " \t" << scaled(c, c.nanoseconds) / 1e6;
+    out.precision(0);
+    event(c, PERF_CYCLES, 1);
+    event(c, PERF_INSTRUCTIONS, 1);
+    out.precision(2);
+    if(eventOpened[PERF_CYCLES] && eventOpened[PERF_INSTRUCTIONS] && c.events[PERF_CYCLES])
+      out << " \t" << (double)c.events[PERF_INSTRUCTIONS] / c.events[PERF_CYCLES];
+    else
+      out << " \t-";
+    out.precision(0);
+    event(c, PERF_CACHE_MISSES, 1);
+    event(c, PERF_BRANCH_MISSES, 1);
+    out << endl;
+  }
+
+  if(numInstructions > 0){
+    double millions = numInstructions / 1e6;
+    out << "PER 1M INSTRUCTIONS: Phase Time(ms) Cycles CacheMisses BranchMisses" << endl;
+    for(int p = 0; p < NumPerfPhases; p++){
+      const PhaseCounts &c = totals[p];
+      if(c.calls == 0)
+	continue;
+      out.precision(2);
+      out << PhaseName[p] << " \t" << scaled(c, c.nanoseconds) / 1e6 / millions;
+      out.precision(0);
+      event(c, PERF_CYCLES, millions);
+      event(c, PERF_CACHE_MISSES, millions);
+      event(c, PERF_BRANCH_MISSES, millions);
+      out << endl;
+    }
+  }
+  out.unsetf(ios::fixed);
+  out.precision(6);
+}
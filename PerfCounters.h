@@ -0,0 +1,86 @@
+#ifndef __PERFCOUNTERS_H__
+#define __PERFCOUNTERS_H__
+
+#include <iostream>
+#include <string>
+#include <stdint.h>
+
+using namespace std;
+
+/* Optional profiling of DCHECKER itself (--perf-counters).  Each thread
+ * opens its own hardware counters (cycles, instructions, cache misses and
+ * branch misses) with perf_event_open the first time it enters a phase.
+ * Counters are read when a phase is entered and left, for one call in
+ * SampleEvery, and the counts are scaled up to all calls.  The thread CPU
+ * time is always measured, so where hardware counters cannot be opened
+ * (e.g. in a container) the report still has the time per phase.  Counts of
+ * counters the kernel multiplexed are scaled by their time enabled over
+ * their time running, and the report says so.  Work a phase hands to other
+ * threads (e.g. ReportWriter's pool) is counted there, in the same phase.
+ *
+ * Profiling is off unless enable is called, and then a PerfScope costs a
+ * single test.
+ */
+
+// Parts of DCHECKER that are measured
+enum PerfPhase {
+  PERF_TOKENIZE,       // ASMParser::getTokens
+  PERF_OPERANDS,       // ASMParser::getOperands
+  PERF_DECODE,         // BinaryParser: decoding the image
+  PERF_CHECK,          // DependencyChecker::addInstruction(s)
+  PERF_OUTPUT,         // formatting and writing the report
+  NumPerfPhases
+};
+
+// Hardware events counted
+enum PerfEvent {
+  PERF_CYCLES,
+  PERF_INSTRUCTIONS,
+  PERF_CACHE_MISSES,
+  PERF_BRANCH_MISSES,
+  NumPerfEvents
+};
+
+class PerfCounters {
+ public:
+  // Reads the counters on one call in this many
+  static const int SampleEvery = 16;
+
+  // Turns profiling on; call before starting other threads
+  static void enable() { ourEnabled = true; };
+
+  // Returns true if profiling is on
+  static bool enabled() { return ourEnabled; };
+
+  // Enters phase p on the calling thread
+  static void begin(PerfPhase p);
+
+  // Leaves phase p on the calling thread
+  static void end(PerfPhase p);
+
+  // Prints the counts of every phase of every thread that has finished (and
+  // of the calling thread), in total and per million of the numInstructions
+  // MIPS instructions analyzed
+  static void print(ostream &out, uint64_t numInstructions);
+
+ private:
+  static bool ourEnabled;
+};
+
+// Measures phase p from its construction to its destruction
+class PerfScope {
+ public:
+  PerfScope(PerfPhase p) : myPhase(p) {
+    if(PerfCounters::enabled())
+      PerfCounters::begin(p);
+  };
+  ~PerfScope() {
+    if(PerfCounters::enabled())
+      PerfCounters::end(myPhase);
+  };
+
+ private:
+  PerfPhase myPhase;
+};
+
+#endif
@@ -87,9 +87,15 @@ RegisterTable::RegisterTable()
 Register RegisterTable::getNum(string reg)
   // Given a string representing a MIPS register operand, returns the number associated
   // with that register.  If string is not a valid register, returns NumRegisters.
+{
+  return getNum(reg.data(), reg.length());
+}
+
+Register RegisterTable::getNum(const char *reg, size_t length)
+  // Same, for the operand in reg[0, length)
 {
   for(int i = 0; i < 2*NumRegisters; i++){
-    if(myRegisters[i].name == reg){
+    if(myRegisters[i].name.compare(0, string::npos, reg, length) == 0){
       return myRegisters[i].number;
     }
 
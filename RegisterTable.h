@@ -25,6 +25,9 @@ class RegisterTable{
   // with that register.  If string is not a valid register, returns NumRegisters.
   Register getNum(string reg);
 
+  // Same, for the operand in reg[0, length)
+  Register getNum(const char *reg, size_t length);
+
  private:
   RegisterEntry myRegisters[64];
 
@@ -0,0 +1,177 @@
+#include "Renamer.h"
+
+Renamer::DependenceCounter::DependenceCounter(int numRegisters)
+  : state(numRegisters)
+{
+  for(int t = 0; t < D_UNDEFINED; t++)
+    counts[t] = 0;
+  instruction = 0;
+}
+
+void Renamer::DependenceCounter::read(int reg)
+{
+  if(state[reg].accessType == WRITE)
+    counts[RAW]++;
+  state[reg].lastInstructionToAccess = instruction;
+  state[reg].accessType = READ;
+}
+
+void Renamer::DependenceCounter::write(int reg)
+{
+  if(state[reg].accessType == WRITE)
+    counts[WAW]++;
+  if(state[reg].accessType == READ)
+    counts[WAR]++;
+  state[reg].lastInstructionToAccess = instruction;
+  state[reg].accessType = WRITE;
+}
+
+
+Renamer::Renamer(ostream &out, int poolSize)
+  // Creates a renamer with poolSize (> NumRegisters) physical registers that
+  // writes the renamed program to out
+  : myOut(out), myBefore(NumRegisters), myAfter(poolSize)
+{
+  myPoolSize = poolSize;
+  myMoves = 0;
+
+  // Architectural registers start out in the physical registers of the same
+  // number; the rest of the pool is free.
+  for(int r = 0; r < NumRegisters; r++)
+    myMap[r] = r;
+  for(int p = NumRegisters; p < poolSize; p++)
+    myFree.push_back(p);
+  myFreeHead = 0;
+}
+
+int Renamer::define(Register r)
+  // Maps a new definition of architectural register r to a free physical register
+{
+  if(r == 0 || myFree.empty())
+    return myMap[r];
+
+  // Take the register freed longest ago; the old mapping takes its slot at
+  // the back of the circular list.
+  int p = myFree[myFreeHead];
+  myFree[myFreeHead] = myMap[r];
+  myFreeHead = (myFreeHead + 1) % myFree.size();
+  myMap[r] = p;
+  return p;
+}
+
+void Renamer::move(int from, int to)
+  // Writes a move of physical register from to physical register to
+{
+  myAfter.read(from);
+  myAfter.read(0);
+  myAfter.write(to);
+  myAfter.instruction++;
+  myOut << myOpcodes.toAssembly(ADD, from, 0, to, 0) << '\n';
+  myMoves++;
+}
+
+void Renamer::restore()
+  // Writes the moves that put every architectural register back in the
+  // physical register of its number, and resets the mapping
+{
+  // A parallel copy: physical r gets the value of physical myMap[r].  A
+  // move is safe once no other pending move still reads its destination.
+  // When only cycles are left, every pending move reads one of the first
+  // NumRegisters, so physical NumRegisters is free to save one value in.
+  vector<int> source(myMap, myMap + NumRegisters);
+  for(;;){
+    bool pending = false, moved = false;
+    for(int r = 0; r < NumRegisters; r++){
+      if(source[r] == r)
+	continue;
+      pending = true;
+      bool read = false;
+      for(int s = 0; s < NumRegisters; s++)
+	if(s != r && source[s] != s && source[s] == r)
+	  read = true;
+      if(!read){
+	move(source[r], r);
+	source[r] = r;
+	moved = true;
+      }
+    }
+    if(!pending)
+      break;
+    if(!moved){
+      // every pending destination is read by another move: save one
+      int r = 0;
+      while(source[r] == r)
+	r++;
+      int temp = NumRegisters;
+      move(r, temp);
+      for(int s = 0; s < NumRegisters; s++)
+	if(source[s] == r)
+	  source[s] = temp;
+    }
+  }
+
+  for(int r = 0; r < NumRegisters; r++)
+    myMap[r] = r;
+  myFree.clear();
+  for(int p = NumRegisters; p < myPoolSize; p++)
+    myFree.push_back(p);
+  myFreeHead = 0;
+}
+
+void Renamer::addInstruction(const Instruction &i, const vector<string> &labels)
+  // Renames the next instruction and writes its assembly, after the names
+  // of the labels defined at it
+{
+  // code jumps in at a label and on to the target of a j with the
+  // registers in their own places
+  if(!labels.empty() || i.getOpcode() == J)
+    restore();
+  for(const string &name : labels)
+    myOut << name << ":\n";
+
+  Opcode o = i.getOpcode();
+  int rs = i.getRS();
+  int rt = i.getRT();
+  int rd = i.getRD();
+
+  // sources read the current mappings, then destinations get new ones
+  if(readsRS(o) && rs < NumRegisters){
+    myBefore.read(rs);
+    rs = myMap[rs];
+    myAfter.read(rs);
+  }
+  if(readsRT(o) && rt < NumRegisters){
+    myBefore.read(rt);
+    rt = myMap[rt];
+    myAfter.read(rt);
+  }
+  if(writesRD(o) && rd < NumRegisters){
+    myBefore.write(rd);
+    rd = define(rd);
+    myAfter.write(rd);
+  }
+  if(writesRT(o) && rt < NumRegisters){
+    myBefore.write(rt);
+    rt = define(rt);
+    myAfter.write(rt);
+  }
+  myBefore.instruction++;
+  myAfter.instruction++;
+
+  if(o == J)
+    myOut << i.getStatement() << '\n';    // keep the target's name
+  else
+    myOut << myOpcodes.toAssembly(o, rs, rt, rd, i.getImmediate()) << '\n';
+}
+
+void Renamer::printCounts(ostream &est)
+  // Prints the dependence counts before and after renaming
+{
+  myOut.flush();
+  est << "Dependences before renaming: RAW " << myBefore.counts[RAW]
+      << " WAR " << myBefore.counts[WAR] << " WAW " << myBefore.counts[WAW] << endl;
+  est << "Dependences after renaming (" << myPoolSize << " registers): RAW "
+      << myAfter.counts[RAW] << " WAR " << myAfter.counts[WAR]
+      << " WAW " << myAfter.counts[WAW] << endl;
+  est << "Moves added at labels and jumps: " << myMoves << endl;
+}
@@ -0,0 +1,87 @@
+#ifndef __RENAMER_H__
+#define __RENAMER_H__
+
+#include <iostream>
+#include <vector>
+#include <string>
+
+using namespace std;
+
+#include "Instruction.h"
+#include "OpcodeTable.h"
+#include "RegisterTable.h"
+#include "DependencyChecker.h"
+
+/* This class removes false (WAR and WAW) dependences by register renaming.
+ * Every new definition of an architectural register is given a physical
+ * register taken from a free list, and every later use is rewritten to read
+ * it.  The physical register previously mapped to that architectural register
+ * goes to the back of the free list, so with a pool of P physical registers a
+ * name is not reused until P - 32 further definitions have been made.  Only
+ * true (RAW) dependences remain as long as the pool is large enough.  $0 is
+ * never renamed.  Everything is done in one linear pass and renamed
+ * instructions are written out as they are produced.
+ *
+ * Code reached by a jump must find the registers where every other way in
+ * leaves them, so before each j and each label the mapping is undone: moves
+ * ("add $r, $p, $0") copy every architectural register back into the
+ * physical register of its own number, and renaming starts over from there.
+ */
+class Renamer {
+ public:
+  // Creates a renamer with poolSize (> NumRegisters) physical registers that
+  // writes the renamed program to out
+  Renamer(ostream &out, int poolSize = 2 * NumRegisters);
+
+  // Renames the next instruction and writes its assembly, after the names
+  // of the labels defined at it
+  void addInstruction(const Instruction &i, const vector<string> &labels = vector<string>());
+
+  // Prints the dependence counts before and after renaming
+  void printCounts(ostream &est);
+
+  // Returns the number of dependences of type t before / after renaming
+  long countBefore(DependenceType t) const { return myBefore.counts[t]; };
+  long countAfter(DependenceType t) const  { return myAfter.counts[t]; };
+
+  // Returns the number of moves added to undo the mapping
+  long numMoves() const { return myMoves; };
+
+ private:
+  /* Counts dependences with the same rules as DependencyChecker, without
+   * recording them, over any number of registers.
+   */
+  struct DependenceCounter {
+    vector<RegisterInfo> state;
+    long counts[D_UNDEFINED];
+    int instruction;                  // number of the current instruction
+
+    DependenceCounter(int numRegisters);
+    void read(int reg);
+    void write(int reg);
+  };
+
+  int myPoolSize;
+  int myMap[NumRegisters];      // physical register holding each architectural one
+  vector<int> myFree;           // circular free list of physical registers
+  size_t myFreeHead;            // index of the next register to hand out
+
+  long myMoves;
+
+  ostream &myOut;               // destination of the renamed assembly
+  DependenceCounter myBefore;
+  DependenceCounter myAfter;
+  OpcodeTable myOpcodes;
+
+  // Maps a new definition of architectural register r to a free physical register
+  int define(Register r);
+
+  // Writes the moves that put every architectural register back in the
+  // physical register of its number, and resets the mapping
+  void restore();
+
+  // Writes a move of physical register from to physical register to
+  void move(int from, int to);
+};
+
+#endif
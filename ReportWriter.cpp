@@ -0,0 +1,108 @@
+#include "ReportWriter.h"
+#include "PerfCounters.h"
+#include <unistd.h>
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include <iostream>
+#include <algorithm>
+
+ReportWriter::ReportWriter(int fd, int numThreads)
+  // Writes to fd using numThreads threads (0: one per hardware thread)
+  : myPool(numThreads)
+{
+  myFd = fd;
+  myError = 0;
+  // Enough ranges per batch to keep every thread busy
+  myBuffers.resize(4 * myPool.size());
+}
+
+void ReportWriter::write(const string &s)
+  // Writes s
+{
+  myBuffers[0] = s;
+  writeBuffers(1);
+}
+
+void ReportWriter::writeRecords(size_t n, const Formatter &format)
+  // Formats records [0, n) with format and writes them in order
+{
+  size_t perBatch = myBuffers.size() * RecordsPerRange;
+
+  for(size_t batch = 0; batch < n && myError == 0; batch += perBatch){
+    size_t ranges = (min(n - batch, perBatch) + RecordsPerRange - 1) / RecordsPerRange;
+
+    myPool.parallelFor(ranges, [&](size_t r){
+	// counted on whichever thread formats the range
+	PerfScope scope(PERF_OUTPUT);
+	size_t first = batch + r * RecordsPerRange;
+	size_t last = min(first + RecordsPerRange, n);
+	myBuffers[r].clear();
+	format(first, last, myBuffers[r]);
+      });
+
+    writeBuffers(ranges);
+  }
+}
+
+void ReportWriter::writeBuffers(size_t count)
+  // Writes all of the given buffers, in order, handling short writes
+{
+  if(myError != 0)
+    return;
+  vector<struct iovec> iov;
+  for(size_t k = 0; k < count; k++){
+    if(myBuffers[k].empty())
+      continue;
+    struct iovec v;
+    v.iov_base = &myBuffers[k][0];
+    v.iov_len = myBuffers[k].size();
+    iov.push_back(v);
+  }
+
+  if(!writeAll(myFd, iov)){
+    myError = errno;
+    cerr << "Could not write the report: " << strerror(myError) << endl;
+  }
+}
+
+void ReportWriter::appendNumber(string &out, long v)
+  // Appends the decimal form of v to out
+{
+  char buf[24];
+  char *p = buf + sizeof(buf);
+  unsigned long u = v < 0 ? -(unsigned long)v : v;
+  do{
+    *--p = '0' + u % 10;
+    u /= 10;
+  } while(u != 0);
+  if(v < 0)
+    *--p = '-';
+  out.append(p, buf + sizeof(buf) - p);
+}
+
+bool ReportWriter::writeAll(int fd, vector<struct iovec> &iov)
+  // Writes all of iov to fd, in order, handling short writes and writing at
+  // most IOV_MAX pieces at a time.  iov is used up.  Returns false on error,
+  // with errno set.
+{
+  size_t k = 0;
+  while(k < iov.size()){
+    ssize_t w = writev(fd, &iov[k], min(iov.size() - k, (size_t)IOV_MAX));
+    if(w < 0){
+      if(errno == EINTR)
+	continue;
+      return false;
+    }
+    // skip what was written
+    while(k < iov.size() && (size_t)w >= iov[k].iov_len){
+      w -= iov[k].iov_len;
+      k++;
+    }
+    if(k < iov.size()){
+      iov[k].iov_base = (char *)iov[k].iov_base + w;
+      iov[k].iov_len -= w;
+    }
+  }
+  return true;
+}
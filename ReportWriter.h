@@ -0,0 +1,57 @@
+#ifndef __REPORTWRITER_H__
+#define __REPORTWRITER_H__
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <sys/uio.h>
+
+using namespace std;
+
+#include "ThreadPool.h"
+
+/* This class writes long reports to a file descriptor.  Records are formatted
+ * in fixed-size ranges on a thread pool, each range into its own buffer, and
+ * the buffers of a batch of ranges are then written in order with a single
+ * writev.  The output is byte for byte what formatting the records one after
+ * another would produce.  If a write fails, the error is reported on stderr
+ * once and nothing more is formatted or written.
+ */
+class ReportWriter {
+ public:
+  // Function that appends the text of records [first, last) to out
+  typedef function<void(size_t first, size_t last, string &out)> Formatter;
+
+  // Writes to fd using numThreads threads (0: one per hardware thread)
+  ReportWriter(int fd, int numThreads = 0);
+
+  // Writes s
+  void write(const string &s);
+
+  // Formats records [0, n) with format and writes them in order
+  void writeRecords(size_t n, const Formatter &format);
+
+  // Returns true if a write failed
+  bool hasError() const { return myError != 0; };
+
+  // Appends the decimal form of v to out
+  static void appendNumber(string &out, long v);
+
+  // Writes all of iov to fd, in order, handling short writes and writing at
+  // most IOV_MAX pieces at a time.  iov is used up.  Returns false on error,
+  // with errno set.
+  static bool writeAll(int fd, vector<struct iovec> &iov);
+
+ private:
+  static const size_t RecordsPerRange = 1 << 14;
+
+  int myFd;
+  int myError;                  // errno of the failed write, or 0
+  ThreadPool myPool;
+  vector<string> myBuffers;     // one per range of a batch, reused
+
+  // Writes all of the given buffers, in order, handling short writes
+  void writeBuffers(size_t count);
+};
+
+#endif
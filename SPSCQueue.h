@@ -0,0 +1,151 @@
+#ifndef __SPSCQUEUE_H__
+#define __SPSCQUEUE_H__
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <stddef.h>
+
+using namespace std;
+
+/* A bounded queue between exactly one producer thread and one consumer
+ * thread.  The slots form a ring indexed by two counters that only ever
+ * grow; the producer alone writes myTail and the consumer alone writes
+ * myHead, so no locks are needed while both keep up.  A full push or an
+ * empty pop spins for a little while, yields the processor a few times and
+ * then sleeps on a condition variable until the other side moves a counter
+ * (which only then takes the lock, to wake it), so a stalled side costs no
+ * processor time.  Elements are moved in and out, so a slot is best a batch of work
+ * (e.g. a vector) rather than a single small item.
+ */
+template<class T>
+class SPSCQueue {
+ public:
+  // Creates a queue holding up to capacity elements (rounded up to a power of 2)
+  SPSCQueue(size_t capacity = 8);
+
+  // Moves item into the queue, waiting while it is full.  Producer only.
+  void push(T &&item);
+
+  // Marks the end of the items.  Producer only, after its last push.
+  void close();
+
+  // Moves the oldest item into item, waiting while the queue is empty.
+  // Returns false, leaving item alone, once the queue is closed and empty.
+  // Consumer only.
+  bool pop(T &item);
+
+ private:
+  static const int SpinsBeforeYield = 64;
+  static const int SpinsBeforeSleep = 256;
+
+  vector<T> mySlots;
+  size_t myMask;
+
+  mutex myLock;
+  condition_variable myChanged;      // signalled when a counter moves
+  atomic<int> mySleepers;            // threads waiting on myChanged
+
+  // Waits, spinning, then yielding, then sleeping, until ready() is true
+  template<class Ready>
+  void wait(Ready ready);
+
+  // Wakes the other side if it sleeps
+  void wake();
+
+  // Kept on separate cache lines so the two threads do not share one
+  alignas(64) atomic<size_t> myHead;    // next slot to pop
+  alignas(64) atomic<size_t> myTail;    // next slot to push
+  alignas(64) atomic<bool> myClosed;
+};
+
+
+template<class T>
+SPSCQueue<T>::SPSCQueue(size_t capacity)
+  // Creates a queue holding up to capacity elements (rounded up to a power of 2)
+  : mySleepers(0), myHead(0), myTail(0), myClosed(false)
+{
+  size_t size = 1;
+  while(size < capacity)
+    size <<= 1;
+  mySlots.resize(size);
+  myMask = size - 1;
+}
+
+template<class T>
+void SPSCQueue<T>::push(T &&item)
+  // Moves item into the queue, waiting while it is full.  Producer only.
+{
+  size_t tail = myTail.load(memory_order_relaxed);
+  wait([this, tail](){ return tail - myHead.load(memory_order_acquire) <= myMask; });
+  mySlots[tail & myMask] = move(item);
+  myTail.store(tail + 1, memory_order_release);
+  wake();
+}
+
+template<class T>
+void SPSCQueue<T>::close()
+  // Marks the end of the items.  Producer only, after its last push.
+{
+  myClosed.store(true, memory_order_release);
+  wake();
+}
+
+template<class T>
+bool SPSCQueue<T>::pop(T &item)
+  // Moves the oldest item into item, waiting while the queue is empty.
+  // Returns false, leaving item alone, once the queue is closed and empty.
+  // Consumer only.
+{
+  size_t head = myHead.load(memory_order_relaxed);
+  // the close is only seen after the last push, so check the tail again
+  wait([this, head](){
+      return head != myTail.load(memory_order_acquire) ||
+	myClosed.load(memory_order_acquire);
+    });
+  if(head == myTail.load(memory_order_acquire))
+    return false;
+  item = move(mySlots[head & myMask]);
+  myHead.store(head + 1, memory_order_release);
+  wake();
+  return true;
+}
+
+template<class T>
+template<class Ready>
+void SPSCQueue<T>::wait(Ready ready)
+  // Waits, spinning, then yielding, then sleeping, until ready() is true
+{
+  for(int spins = 0; !ready(); spins++){
+    if(spins < SpinsBeforeYield)
+      continue;
+    if(spins < SpinsBeforeSleep){
+      this_thread::yield();
+      continue;
+    }
+    unique_lock<mutex> lock(myLock);
+    mySleepers.fetch_add(1);
+    // pairs with the fence in wake: either the other side sees the sleeper
+    // or this sees its move
+    atomic_thread_fence(memory_order_seq_cst);
+    myChanged.wait(lock, ready);
+    mySleepers.fetch_sub(1);
+    return;
+  }
+}
+
+template<class T>
+void SPSCQueue<T>::wake()
+  // Wakes the other side if it sleeps
+{
+  atomic_thread_fence(memory_order_seq_cst);
+  if(mySleepers.load(memory_order_relaxed) == 0)
+    return;
+  lock_guard<mutex> lock(myLock);
+  myChanged.notify_all();
+}
+
+#endif
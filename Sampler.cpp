@@ -0,0 +1,114 @@
+#include "Sampler.h"
+#include <math.h>
+
+Sampler::Sampler(double rate, long window, long warmup, unsigned seed)
+  // Samples about rate of the stream in windows of window instructions,
+  // each warmed up on warmup instructions.  seed selects the windows.
+  : myRandom(seed)
+{
+  myWindow = window;
+  myWarmup = warmup;
+  myPeriod = (long)(window / rate);
+  if(myPeriod < window + warmup)
+    myPeriod = window + warmup;
+
+  myInWindow = false;
+  myTotal = 0;
+  myWindows = 0;
+  myWindowInstructions = 0;
+  for(int t = 0; t < D_UNDEFINED; t++){
+    myWindowCount[t] = 0;
+    myRateSum[t] = myRateSquares[t] = 0;
+  }
+}
+
+long Sampler::nextOffset()
+  // Returns a random start of the warmup within the next period
+{
+  uniform_int_distribution<long> offset(0, myPeriod - myWindow - myWarmup);
+  return offset(myRandom);
+}
+
+void Sampler::beginWindow()
+  // Starts counting a window
+{
+  myInWindow = true;
+  myWindowInstructions = 0;
+  for(int t = 0; t < D_UNDEFINED; t++)
+    myWindowCount[t] = 0;
+}
+
+void Sampler::endWindow()
+  // Adds the rates of the window just counted
+{
+  myInWindow = false;
+  if(myWindowInstructions == 0)
+    return;
+
+  myWindows++;
+  for(int t = 0; t < D_UNDEFINED; t++){
+    double rate = (double)myWindowCount[t] / myWindowInstructions;
+    myRateSum[t] += rate;
+    myRateSquares[t] += rate * rate;
+  }
+}
+
+void Sampler::dependenceFound(const Dependence &d, Opcode consumer)
+  // DependenceListener: counts dependences of window instructions
+{
+  if(!myInWindow)
+    return;
+  myWindowCount[d.dependenceType]++;
+  myStats.dependenceFound(d, consumer);
+}
+
+void Sampler::instructionAdded(const Instruction &i)
+  // DependenceListener: counts window instructions
+{
+  if(!myInWindow)
+    return;
+  myWindowInstructions++;
+  myStats.instructionAdded(i);
+}
+
+void Sampler::print(ostream &out) const
+  // Prints the estimates and the statistics of the sample
+{
+  uint64_t sampled = myStats.numInstructions();
+  out << "SAMPLED: " << myWindows << " windows, " << sampled << " of "
+      << myTotal << " instructions" << endl;
+  if(myWindows == 0)
+    return;
+
+  out << "ESTIMATES (95% confidence): Type PerInstr Total" << endl;
+  out.setf(ios::fixed);
+  for(int t = 0; t < D_UNDEFINED; t++){
+    double n = myWindows;
+    double mean = myRateSum[t] / n;
+    double variance = n > 1 ? (myRateSquares[t] - n * mean * mean) / (n - 1) : 0;
+    double half = variance > 0 ? 1.96 * sqrt(variance / n) : 0;
+    out.precision(6);
+    out << DependenceTypeName[t] << " \t" << mean << " +- " << half;
+    out.precision(0);
+    out << " \t" << mean * myTotal << " +- " << half * myTotal << endl;
+  }
+
+  // the sampled distances, scaled up to the whole stream
+  double scale = sampled ? (double)myTotal / sampled : 0;
+  out << "ESTIMATED DISTANCES: [from, to) RAW WAR WAW" << endl;
+  for(int b = 0; b < DependenceStats::NumBuckets; b++){
+    if(myStats.bucketCount(RAW, b) + myStats.bucketCount(WAR, b) +
+       myStats.bucketCount(WAW, b) == 0)
+      continue;
+    uint64_t lo = b == 0 ? 0 : (uint64_t)1 << (b - 1);
+    uint64_t hi = (uint64_t)1 << b;
+    out << "[" << lo << ", " << hi << ") \t" << myStats.bucketCount(RAW, b) * scale
+	<< " \t" << myStats.bucketCount(WAR, b) * scale << " \t"
+	<< myStats.bucketCount(WAW, b) * scale << endl;
+  }
+  out.unsetf(ios::fixed);
+  out.precision(6);
+
+  out << "SAMPLE:" << endl;
+  myStats.print(out);
+}
@@ -0,0 +1,114 @@
+#ifndef __SAMPLER_H__
+#define __SAMPLER_H__
+
+#include <iostream>
+#include <random>
+#include <stdint.h>
+
+using namespace std;
+
+#include "Instruction.h"
+#include "DependencyChecker.h"
+#include "DependenceStats.h"
+
+/* This class estimates the dependence statistics of a long instruction
+ * stream from a sample of windows.  The stream is cut into periods of
+ * window / rate instructions and one window is taken from a random place
+ * in each period.  Each window is checked from a fresh register table that
+ * is first warmed up on the instructions just before it; only the
+ * dependences of the window's own instructions are counted.  Everything
+ * else is skipped without being decoded (see the parsers' skip), so the
+ * work grows with the sample, not with the stream.
+ *
+ * The per-instruction hazard rates are estimated by the mean over the
+ * windows, with a 95% confidence interval from the spread between windows.
+ */
+class Sampler : public DependenceListener {
+ public:
+  // Samples about rate of the stream in windows of window instructions,
+  // each warmed up on warmup instructions.  seed selects the windows.
+  Sampler(double rate, long window, long warmup, unsigned seed = 1);
+
+  // Reads parser to the end, checking the sampled windows
+  template<class Parser>
+  void sample(Parser &parser);
+
+  // Prints the estimates and the statistics of the sample
+  void print(ostream &out) const;
+
+  // DependenceListener: counts dependences of window instructions
+  void dependenceFound(const Dependence &d, Opcode consumer);
+
+  // DependenceListener: counts window instructions
+  void instructionAdded(const Instruction &i);
+
+ private:
+  long myPeriod;
+  long myWindow;
+  long myWarmup;
+  mt19937 myRandom;
+
+  bool myInWindow;                   // counting the current instructions?
+  DependenceStats myStats;           // everything counted, over all windows
+  uint64_t myTotal;                  // instructions in the whole stream
+  uint64_t myWindows;                // windows sampled
+
+  // Counts of the current window, and sums over windows of the
+  // per-instruction rates and of their squares
+  uint64_t myWindowCount[D_UNDEFINED];
+  uint64_t myWindowInstructions;
+  double myRateSum[D_UNDEFINED];
+  double myRateSquares[D_UNDEFINED];
+
+  // Starts counting a window
+  void beginWindow();
+
+  // Adds the rates of the window just counted
+  void endWindow();
+
+  // Returns a random start of the warmup within the next period
+  long nextOffset();
+};
+
+
+template<class Parser>
+void Sampler::sample(Parser &parser)
+  // Reads parser to the end, checking the sampled windows
+{
+  for(;;){
+    long offset = nextOffset();
+    long skipped = parser.skip(offset);
+    myTotal += skipped;
+    if(skipped < offset)
+      return;
+
+    DependencyChecker checker;
+    checker.setListener(this, false);
+    long used = 0;
+    bool done = false;
+    for(long k = 0; k < myWarmup + myWindow && !done; k++){
+      if(k == myWarmup)
+	beginWindow();
+      Instruction i = parser.getNextInstruction();
+      if(i.getOpcode() == UNDEFINED)
+	done = true;
+      else{
+	checker.addInstruction(i);
+	used++;
+      }
+    }
+    if(myInWindow)
+      endWindow();
+    myTotal += used;
+    if(done)
+      return;
+
+    long rest = myPeriod - offset - used;
+    skipped = parser.skip(rest);
+    myTotal += skipped;
+    if(skipped < rest)
+      return;
+  }
+}
+
+#endif
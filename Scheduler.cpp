@@ -0,0 +1,202 @@
+#include "Scheduler.h"
+#include <queue>
+#include <algorithm>
+
+Scheduler::Scheduler(const LatencyTable &latencies)
+  // Creates a scheduler using the given latencies
+  : myLatencies(latencies)
+{
+  myStallsBefore = myStallsAfter = 0;
+}
+
+
+void Scheduler::addInstruction(const Instruction &i, const vector<string> &labels)
+  // Adds the next instruction of the program, with the names of the labels
+  // defined at it
+{
+  if(!labels.empty())
+    myLabels[myProgram.size()] = labels;
+  myProgram.push_back(i);
+}
+
+
+void Scheduler::schedule()
+  // Reorders every region of the program.  O(n log n) per region.
+{
+  myScheduled.clear();
+  myScheduled.reserve(myProgram.size());
+
+  int first = 0;
+  for(int k = 0; k < (int)myProgram.size(); k++){
+    // code can jump to a label, so one starts a region
+    if(k > first && myLabels.count(k)){
+      scheduleRegion(first, k);
+      first = k;
+    }
+    if(myProgram[k].getOpcode() == J){
+      scheduleRegion(first, k);
+      myScheduled.push_back(myProgram[k]);
+      first = k + 1;
+    }
+  }
+  scheduleRegion(first, myProgram.size());
+
+  myStallsBefore = countStalls(myProgram);
+  myStallsAfter = countStalls(myScheduled);
+}
+
+
+void Scheduler::scheduleRegion(int first, int last)
+  // Schedules instructions [first, last) of myProgram, none of which is a
+  // jump and only the first of which may have labels, and appends them to
+  // myScheduled
+{
+  int n = last - first;
+  if(n <= 0)
+    return;
+
+  // Build the DAG.  Per register: last writer and the readers since then.
+  // LO is register NumRegisters.
+  const Register LO = NumRegisters;
+  vector< vector<Edge> > succ(n);
+  vector<int> numPreds(n, 0);
+  vector<int> lastWriter(NumRegisters + 1, -1);
+  vector< vector<int> > readers(NumRegisters + 1);
+
+  auto addEdge = [&](int from, int to, int latency){
+    if(from == to)
+      return;
+    Edge e = { to, latency };
+    succ[from].push_back(e);
+    numPreds[to]++;
+  };
+  auto read = [&](int k, Register r){
+    if(r < 0 || r > LO)
+      return;
+    if(lastWriter[r] != -1)      // RAW
+      addEdge(lastWriter[r], k,
+	      myLatencies.get(myProgram[first + lastWriter[r]].getOpcode()));
+    readers[r].push_back(k);
+  };
+  auto write = [&](int k, Register r){
+    if(r < 0 || r > LO)
+      return;
+    for(int reader : readers[r])  // WAR
+      addEdge(reader, k, 1);
+    if(lastWriter[r] != -1)      // WAW
+      addEdge(lastWriter[r], k, 1);
+    readers[r].clear();
+    lastWriter[r] = k;
+  };
+
+  for(int k = 0; k < n; k++){
+    const Instruction &i = myProgram[first + k];
+    Opcode o = i.getOpcode();
+    if(readsRS(o)) read(k, i.getRS());
+    if(readsRT(o)) read(k, i.getRT());
+    if(writesRD(o)) write(k, i.getRD());
+    if(writesRT(o)) write(k, i.getRT());
+    if(readsLO(o)) read(k, LO);
+    if(writesLO(o)) write(k, LO);
+  }
+
+  // Priority: latency-weighted height of each node.  Edges always point
+  // forward in program order, so one backward sweep suffices.
+  vector<long> height(n);
+  for(int k = n - 1; k >= 0; k--){
+    height[k] = myLatencies.get(myProgram[first + k].getOpcode());
+    for(const Edge &e : succ[k])
+      height[k] = max(height[k], e.latency + height[e.to]);
+  }
+
+  // List scheduling, one instruction per cycle.  Instructions whose
+  // predecessors are all issued wait in 'pending' until their operands are
+  // ready, then move to 'ready', which is ordered by height (ties: program
+  // order).
+  typedef pair<long, int> Key;
+  priority_queue<Key, vector<Key>, greater<Key> > pending;   // (earliest, k)
+  auto lower = [&](int a, int b){
+    if(height[a] != height[b])
+      return height[a] < height[b];
+    return a > b;
+  };
+  priority_queue<int, vector<int>, decltype(lower)> ready(lower);
+  vector<long> earliest(n, 0);
+
+  for(int k = 0; k < n; k++)
+    if(numPreds[k] == 0)
+      pending.push(Key(0, k));
+
+  long cycle = 0;
+  for(int done = 0; done < n; done++){
+    if(ready.empty() && pending.top().first > cycle)
+      cycle = pending.top().first;          // stall until something is ready
+    while(!pending.empty() && pending.top().first <= cycle){
+      ready.push(pending.top().second);
+      pending.pop();
+    }
+
+    int k = ready.top();
+    ready.pop();
+    myScheduled.push_back(myProgram[first + k]);
+
+    for(const Edge &e : succ[k]){
+      earliest[e.to] = max(earliest[e.to], cycle + e.latency);
+      if(--numPreds[e.to] == 0)
+	pending.push(Key(earliest[e.to], e.to));
+    }
+    cycle++;
+  }
+}
+
+
+long Scheduler::countStalls(const vector<Instruction> &prog) const
+  // Returns the stall cycles of prog on a single issue in-order pipeline
+{
+  const Register LO = NumRegisters;
+  vector<long> ready(NumRegisters + 1, 0);   // cycle each register's value is available
+  long cycle = 0;
+  long stalls = 0;
+
+  for(const Instruction &i : prog){
+    Opcode o = i.getOpcode();
+    long issue = cycle;
+    if(readsRS(o) && i.getRS() < NumRegisters)
+      issue = max(issue, ready[i.getRS()]);
+    if(readsRT(o) && i.getRT() < NumRegisters)
+      issue = max(issue, ready[i.getRT()]);
+    if(readsLO(o))
+      issue = max(issue, ready[LO]);
+    stalls += issue - cycle;
+
+    long avail = issue + myLatencies.get(o);
+    if(writesRD(o) && i.getRD() < NumRegisters)
+      ready[i.getRD()] = avail;
+    if(writesRT(o) && i.getRT() < NumRegisters)
+      ready[i.getRT()] = avail;
+    if(writesLO(o))
+      ready[LO] = avail;
+    cycle = issue + 1;
+  }
+  return stalls;
+}
+
+
+void Scheduler::print(ostream &out, ostream &est) const
+  // Prints the assembly of the scheduled program, with its labels, to out
+  // and the stall estimate to est
+{
+  // regions keep their places, so the labels of the instruction at k in
+  // the program go in front of the instruction at k in the schedule
+  for(size_t k = 0; k < myScheduled.size(); k++){
+    map<size_t, vector<string> >::const_iterator labels = myLabels.find(k);
+    if(labels != myLabels.end())
+      for(const string &name : labels->second)
+	out << name << ":\n";
+    out << myScheduled[k].getStatement() << '\n';
+  }
+  out.flush();
+
+  est << "Stall cycles before scheduling: " << myStallsBefore << endl;
+  est << "Stall cycles after scheduling: " << myStallsAfter << endl;
+}
@@ -0,0 +1,73 @@
+#ifndef __SCHEDULER_H__
+#define __SCHEDULER_H__
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <map>
+
+using namespace std;
+
+#include "Instruction.h"
+#include "OpcodeTable.h"
+#include "RegisterTable.h"
+#include "CriticalPath.h"
+
+/* This class reorders instructions to reduce pipeline stalls.  The program is
+ * split into straight-line regions that end at each "j" and start again at
+ * each instruction with labels, where other code can jump in.  For every
+ * region a dependence DAG with all RAW, WAR and WAW edges is built, counting
+ * LO (written by mult, read by mflo) as one more register, and a list
+ * scheduler issues, at every cycle, the ready instruction with the longest
+ * latency-weighted path to the end of the region.  Only RAW edges carry the
+ * producer's latency; WAR and WAW edges just keep the order.  A jump always
+ * stays at the end of its region, and the labels of a region stay at its
+ * start.
+ */
+class Scheduler {
+ public:
+  // Creates a scheduler using the given latencies
+  Scheduler(const LatencyTable &latencies);
+
+  // Adds the next instruction of the program, with the names of the labels
+  // defined at it
+  void addInstruction(const Instruction &i, const vector<string> &labels = vector<string>());
+
+  // Reorders every region of the program.  O(n log n) per region.
+  void schedule();
+
+  // Returns the program in scheduled order (empty before schedule())
+  const vector<Instruction> &getProgram() const { return myScheduled; };
+
+  // Returns the estimated stall cycles of the original and scheduled programs
+  long stallsBefore() const { return myStallsBefore; };
+  long stallsAfter() const  { return myStallsAfter; };
+
+  // Prints the assembly of the scheduled program, with its labels, to out
+  // and the stall estimate to est
+  void print(ostream &out, ostream &est) const;
+
+ private:
+  // An edge of the dependence DAG
+  struct Edge {
+    int to;         // index within the region
+    int latency;    // cycles between issuing the two instructions
+  };
+
+  const LatencyTable &myLatencies;
+  vector<Instruction> myProgram;
+  vector<Instruction> myScheduled;
+  map<size_t, vector<string> > myLabels;   // by instruction, where there are any
+  long myStallsBefore;
+  long myStallsAfter;
+
+  // Schedules instructions [first, last) of myProgram, none of which is a
+  // jump and only the first of which may have labels, and appends them to
+  // myScheduled
+  void scheduleRegion(int first, int last);
+
+  // Returns the stall cycles of prog on a single issue in-order pipeline
+  long countStalls(const vector<Instruction> &prog) const;
+};
+
+#endif
@@ -0,0 +1,93 @@
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(int numThreads)
+  // Starts numThreads - 1 workers; 0 means one thread per hardware thread
+{
+  if(numThreads <= 0)
+    numThreads = thread::hardware_concurrency();
+  if(numThreads <= 0)
+    numThreads = 1;
+
+  myTask = NULL;
+  myCount = 0;
+  myNext = 0;
+  myGeneration = 0;
+  myBusy = 0;
+  myStop = false;
+
+  for(int t = 1; t < numThreads; t++)
+    myWorkers.push_back(thread(&ThreadPool::workerLoop, this));
+}
+
+ThreadPool::~ThreadPool()
+  // Stops and joins the workers
+{
+  {
+    lock_guard<mutex> guard(myLock);
+    myStop = true;
+  }
+  myStart.notify_all();
+  for(size_t t = 0; t < myWorkers.size(); t++)
+    myWorkers[t].join();
+}
+
+
+void ThreadPool::parallelFor(size_t n, const function<void(size_t)> &task)
+  // Calls task(k) for every k in [0, n) and returns when all calls are done.
+  // Calls for different k may run concurrently.
+{
+  if(n == 0)
+    return;
+  if(myWorkers.empty() || n == 1){
+    for(size_t k = 0; k < n; k++)
+      task(k);
+    return;
+  }
+
+  {
+    lock_guard<mutex> guard(myLock);
+    myTask = &task;
+    myCount = n;
+    myNext = 0;
+    myBusy = myWorkers.size();
+    myGeneration++;
+  }
+  myStart.notify_all();
+
+  runIterations();
+
+  unique_lock<mutex> guard(myLock);
+  myFinish.wait(guard, [this]{ return myBusy == 0; });
+  myTask = NULL;
+}
+
+void ThreadPool::runIterations()
+  // Runs iterations of the current loop until none are left
+{
+  size_t k;
+  while((k = myNext.fetch_add(1)) < myCount)
+    (*myTask)(k);
+}
+
+void ThreadPool::workerLoop()
+  // Body of the worker threads
+{
+  unsigned long seen = 0;
+  while(true){
+    {
+      unique_lock<mutex> guard(myLock);
+      myStart.wait(guard, [&]{ return myStop || myGeneration != seen; });
+      if(myStop)
+	return;
+      seen = myGeneration;
+    }
+
+    runIterations();
+
+    {
+      lock_guard<mutex> guard(myLock);
+      myBusy--;
+    }
+    myFinish.notify_one();
+  }
+}
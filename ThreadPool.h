@@ -0,0 +1,54 @@
+#ifndef __THREADPOOL_H__
+#define __THREADPOOL_H__
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+using namespace std;
+
+/* A fixed set of worker threads that run parallel loops.  parallelFor hands
+ * out loop indices one at a time, so uneven tasks balance themselves.  The
+ * calling thread works on the loop too, so a pool of size 1 runs everything
+ * on the caller.
+ */
+class ThreadPool {
+ public:
+  // Starts numThreads - 1 workers; 0 means one thread per hardware thread
+  ThreadPool(int numThreads = 0);
+
+  // Stops and joins the workers
+  ~ThreadPool();
+
+  // Returns the number of threads that run loop iterations
+  int size() const { return myWorkers.size() + 1; };
+
+  // Calls task(k) for every k in [0, n) and returns when all calls are done.
+  // Calls for different k may run concurrently.
+  void parallelFor(size_t n, const function<void(size_t)> &task);
+
+ private:
+  vector<thread> myWorkers;
+  mutex myLock;
+  condition_variable myStart;      // signalled when a loop begins
+  condition_variable myFinish;     // signalled when a worker leaves a loop
+
+  // The loop currently running
+  const function<void(size_t)> *myTask;
+  size_t myCount;
+  atomic<size_t> myNext;           // next index to hand out
+  unsigned long myGeneration;      // incremented for every loop
+  int myBusy;                      // workers still inside the loop
+  bool myStop;
+
+  // Body of the worker threads
+  void workerLoop();
+
+  // Runs iterations of the current loop until none are left
+  void runIterations();
+};
+
+#endif
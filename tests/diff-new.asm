@@ -0,0 +1,11 @@
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $5, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+
+add $9, $1, $1
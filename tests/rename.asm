@@ -0,0 +1,5 @@
+add $3, $1, $2
+add $3, $3, $3
+loop: add $1, $1, $2
+addi $2, $1, 4
+j loop
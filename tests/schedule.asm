@@ -0,0 +1,9 @@
+add $1, $2, $3
+loop: add $4, $5, $6
+lb $7, 0($4)
+add $8, $7, $7
+j loop
+mult $2, $3
+mflo $1
+add $4, $1, $1
+add $9, $5, $6
@@ -0,0 +1,4800 @@
+j label
+add $3, $4, $8
+addi $1, $2, 100
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mflo $1
+xor $3, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
@@ -0,0 +1,5000 @@
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100
+j label
+add $3, $4, $8
+addi $1, $2, 100
+mult $2, $3
+mflo $1
+xor $3, $1, $4
+sll $3, $2, 10
+slt $1, $2, $3
+lb $1, 100($2)
+slti $2, $1, 100